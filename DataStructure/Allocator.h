@@ -1,12 +1,192 @@
 #pragma once
 
+#include <cstddef>
+#include <new>
+#include <stdint.h>
+#include <type_traits>
+#include <utility>
+
 namespace adt {
 
+/// дС
+constexpr size_t CacheLineSize = 64;
+
+/// СڸóߴԻж
+constexpr size_t LargeBufferSize = 256;
+
 class Allocator {
 public:
   static char *Allocate(size_t Size) { return new char[Size]; }
 
-  static void Deallocate(void *Buffer) { delete[] Buffer; }
+  /// @brief:Alignment䣬Alignment2
+  static char *Allocate(size_t Size, size_t Alignment) {
+    return (char *)::operator new(Size, std::align_val_t(Alignment));
+  }
+
+  static void Deallocate(void *Buffer) { delete[] (char *)Buffer; }
+
+  /// @brief:ߴͷţSizeΪʱֽ
+  static void Deallocate(void *Buffer, size_t) { Deallocate(Buffer); }
+
+  /// @brief:ͷŶڴ
+  static void Deallocate(void *Buffer, size_t, size_t Alignment) {
+    ::operator delete(Buffer, std::align_val_t(Alignment));
+  }
+};
+
+/// @brief:̬ڴԴstd::pmr::memory_resource
+class MemoryResource {
+public:
+  virtual ~MemoryResource() = default;
+
+  char *Allocate(size_t Size) { return DoAllocate(Size); }
+
+  void Deallocate(void *Buffer, size_t Size) { DoDeallocate(Buffer, Size); }
+
+protected:
+  virtual char *DoAllocate(size_t Size) = 0;
+  virtual void DoDeallocate(void *Buffer, size_t Size) = 0;
+};
+
+/// @brief:ֱʹAllocatorڴԴ
+class NewDeleteResource : public MemoryResource {
+public:
+  static NewDeleteResource *Get() {
+    static NewDeleteResource resource;
+    return &resource;
+  }
+
+protected:
+  char *DoAllocate(size_t Size) override { return Allocator::Allocate(Size); }
+
+  void DoDeallocate(void *Buffer, size_t Size) override {
+    Allocator::Deallocate(Buffer, Size);
+  }
+};
+
+/// @brief:״̬ķתʱָMemoryResource
+class ResourceAllocator {
+public:
+  ResourceAllocator() : resource_(NewDeleteResource::Get()) {}
+  ResourceAllocator(MemoryResource *Resource) : resource_(Resource) {}
+
+  char *Allocate(size_t Size) { return resource_->Allocate(Size); }
+
+  void Deallocate(void *Buffer, size_t Size) {
+    resource_->Deallocate(Buffer, Size);
+  }
+
+  MemoryResource *resource() const { return resource_; }
+
+  bool operator==(const ResourceAllocator &Right) const {
+    return resource_ == Right.resource_;
+  }
+
+  bool operator!=(const ResourceAllocator &Right) const {
+    return resource_ != Right.resource_;
+  }
+
+private:
+  MemoryResource *resource_;
+};
+
+/// @brief:ͳһ÷Ķӿ
+/// ṩAllocate(Size, Alignment)ʱֱӵãAlignmentֽں
+/// ֶ룬ԭʼַڶַ֮ǰ
+template <typename AllocatorTy> class AllocatorTraits {
+  template <typename Al>
+  static auto HasAligned(int)
+      -> decltype(std::declval<Al &>().Allocate(size_t(), size_t()),
+                  std::true_type());
+  template <typename Al> static std::false_type HasAligned(...);
+
+public:
+  static constexpr bool SupportAligned =
+      decltype(HasAligned<AllocatorTy>(0))::value;
+
+  static char *Allocate(AllocatorTy &Al, size_t Size, size_t Alignment) {
+    if (Alignment <= alignof(std::max_align_t))
+      return Al.Allocate(Size);
+    return AllocateAligned(Al, Size, Alignment,
+                           std::integral_constant<bool, SupportAligned>());
+  }
+
+  static void Deallocate(AllocatorTy &Al, void *Buffer, size_t Size,
+                         size_t Alignment) {
+    if (Alignment <= alignof(std::max_align_t))
+      Al.Deallocate(Buffer, Size);
+    else
+      DeallocateAligned(Al, Buffer, Size, Alignment,
+                        std::integral_constant<bool, SupportAligned>());
+  }
+
+  /// @brief:ԻLargeBufferSizeʱж
+  static char *AllocateBuffer(AllocatorTy &Al, size_t Size,
+                              size_t MinAlignment = 1) {
+    return Allocate(Al, Size, BufferAlignment(Size, MinAlignment));
+  }
+
+  static void DeallocateBuffer(AllocatorTy &Al, void *Buffer, size_t Size,
+                               size_t MinAlignment = 1) {
+    Deallocate(Al, Buffer, Size, BufferAlignment(Size, MinAlignment));
+  }
+
+  static size_t BufferAlignment(size_t Size, size_t MinAlignment) {
+    size_t alignment =
+        Size >= LargeBufferSize ? CacheLineSize : alignof(std::max_align_t);
+    return alignment > MinAlignment ? alignment : MinAlignment;
+  }
+
+private:
+  static char *AllocateAligned(AllocatorTy &Al, size_t Size, size_t Alignment,
+                               std::true_type) {
+    return Al.Allocate(Size, Alignment);
+  }
+
+  static char *AllocateAligned(AllocatorTy &Al, size_t Size, size_t Alignment,
+                               std::false_type) {
+    char *raw = Al.Allocate(Size + Alignment);
+    char *aligned = (char *)(((uintptr_t)raw + Alignment) &
+                             ~(uintptr_t)(Alignment - 1));
+    ((char **)aligned)[-1] = raw;
+    return aligned;
+  }
+
+  static void DeallocateAligned(AllocatorTy &Al, void *Buffer, size_t Size,
+                                size_t Alignment, std::true_type) {
+    Al.Deallocate(Buffer, Size, Alignment);
+  }
+
+  static void DeallocateAligned(AllocatorTy &Al, void *Buffer, size_t Size,
+                                size_t Alignment, std::false_type) {
+    if (Buffer)
+      Al.Deallocate(((char **)Buffer)[-1], Size + Alignment);
+  }
+};
+
+/// @brief:бʵ״̬ķͨջŻռÿռ
+template <typename AllocatorTy,
+          bool = std::is_empty<AllocatorTy>::value &&
+                 !std::is_final<AllocatorTy>::value>
+class AllocatorHolder : private AllocatorTy {
+public:
+  AllocatorHolder() = default;
+  explicit AllocatorHolder(const AllocatorTy &Al) : AllocatorTy(Al) {}
+
+  AllocatorTy &GetAllocator() { return *this; }
+  const AllocatorTy &GetAllocator() const { return *this; }
+};
+
+template <typename AllocatorTy> class AllocatorHolder<AllocatorTy, false> {
+public:
+  AllocatorHolder() = default;
+  explicit AllocatorHolder(const AllocatorTy &Al) : allocator_(Al) {}
+
+  AllocatorTy &GetAllocator() { return allocator_; }
+  const AllocatorTy &GetAllocator() const { return allocator_; }
+
+private:
+  AllocatorTy allocator_;
 };
 
 } // namespace adt
\ No newline at end of file
@@ -0,0 +1,145 @@
+/**
+ * Arena: (bump-pointer)ڴ
+ * Ӵڴ(chunk)˳зСڴ棬ڴͷΪղ
+ * ֻͨResetһͷȫchunkͷŴΪO(chunk)O()
+ * ͨResourceAllocator(&arena)Ϊ״̬
+ * 
+ *	Allocate		ӵǰchunkзSizeֽ
+ *	Deallocate		ղ
+ *	Reset			ͷchunk
+ **/
+#pragma once
+
+#include "Allocator.h"
+#include <cstddef>
+#include <stdint.h>
+
+namespace adt {
+
+class Arena : public MemoryResource {
+public:
+  static constexpr size_t Alignment = alignof(std::max_align_t);
+
+public:
+  explicit Arena(size_t ChunkSize = 64 * 1024) : chunk_size_(ChunkSize) {}
+
+  Arena(const Arena &) = delete;
+  Arena &operator=(const Arena &) = delete;
+
+  ~Arena() { Reset(); }
+
+  /// @brief:SizeֽڣAlignment
+  char *Allocate(size_t Size) { return Allocate(Size, Alignment); }
+
+  /// @brief:SizeֽڣAlign룬Align2
+  char *Allocate(size_t Size, size_t Align) {
+    size_t aligned = AlignUp(Size == 0 ? 1 : Size);
+    if (Align > Alignment) {
+      /// ȰAlignǰλãʣռ䲻ʱAlignֽٶ룬
+      /// chunkֻ֤Alignment룬ֱз·
+      char *pos = AlignPointer(cur_, Align);
+      if (!cur_ || pos > end_ || aligned > (size_t)(end_ - pos))
+        return AlignPointer(Allocate(aligned + Align, Alignment), Align);
+      cur_ = pos;
+    }
+    if (aligned > (size_t)(end_ - cur_)) {
+      /// ڴ浥ռһchunkϵǰchunkз
+      if (aligned > chunk_size_ / 4)
+        return NewChunk(aligned, false);
+      cur_ = NewChunk(chunk_size_, true);
+      end_ = cur_ + chunk_size_;
+    }
+    char *ptr = cur_;
+    cur_ += aligned;
+    return ptr;
+  }
+
+  /// @brief:ڴ鲻գͳһResetͷ
+  void Deallocate(void *) {}
+  void Deallocate(void *, size_t) {}
+  void Deallocate(void *, size_t, size_t) {}
+
+  /// @brief:ͷchunk
+  void Reset() {
+    Chunk *chunk = chunks_;
+    while (chunk) {
+      Chunk *next = chunk->Next;
+      Allocator::Deallocate(chunk);
+      chunk = next;
+    }
+    chunks_ = nullptr;
+    cur_ = end_ = nullptr;
+    reserved_ = 0;
+  }
+
+  /// @brief:ϵͳֽ
+  size_t reserved() const { return reserved_; }
+
+protected:
+  char *DoAllocate(size_t Size) override { return Allocate(Size); }
+
+  void DoDeallocate(void *, size_t) override {}
+
+private:
+  struct Chunk {
+    Chunk *Next;
+  };
+
+  static size_t AlignUp(size_t Size) {
+    return (Size + Alignment - 1) & ~(Alignment - 1);
+  }
+
+  static char *AlignPointer(char *Ptr, size_t Align) {
+    return (char *)(((uintptr_t)Ptr + Align - 1) & ~(uintptr_t)(Align - 1));
+  }
+
+  /// @brief:һSizeֽڵchunkҵ
+  /// @param Current ΪtrueʱchunkΪǰзֵchunk
+  char *NewChunk(size_t Size, bool Current) {
+    const size_t header = AlignUp(sizeof(Chunk));
+    Chunk *chunk = (Chunk *)Allocator::Allocate(header + Size);
+    if (Current || !chunks_) {
+      chunk->Next = chunks_;
+      chunks_ = chunk;
+    } else {
+      /// Ĵڵǰchunk֮󣬱ͷΪǰchunk
+      chunk->Next = chunks_->Next;
+      chunks_->Next = chunk;
+    }
+    reserved_ += header + Size;
+    return (char *)chunk + header;
+  }
+
+private:
+  size_t chunk_size_;
+  size_t reserved_ = 0;
+  Chunk *chunks_ = nullptr;
+  char *cur_ = nullptr;
+  char *end_ = nullptr;
+};
+
+/// @brief:ArenaķԣΪAllocatorTy
+/// @note:ͬһTagһArena̰߳ȫ
+template <typename Tag = void, size_t ChunkSize = 64 * 1024>
+class ArenaAllocator {
+public:
+  static char *Allocate(size_t Size) { return GetArena().Allocate(Size); }
+
+  static char *Allocate(size_t Size, size_t Alignment) {
+    return GetArena().Allocate(Size, Alignment);
+  }
+
+  static void Deallocate(void *) {}
+  static void Deallocate(void *, size_t) {}
+  static void Deallocate(void *, size_t, size_t) {}
+
+  /// @brief:һͷŸTagڴ棬úЩʹ
+  static void Reset() { GetArena().Reset(); }
+
+  static Arena &GetArena() {
+    static Arena arena(ChunkSize);
+    return arena;
+  }
+};
+
+} // namespace adt
\ No newline at end of file
@@ -3,6 +3,8 @@
 #include "TreeIterator.h"
 #include "Vector.h"
 #include "Basis.h"
+#include "SmallVector.h"
+#include "Stack.h"
 #include <algorithm>
 
 namespace adt {
@@ -29,8 +31,6 @@ template <typename Ty> struct AvlTreeNode {
 
   template <typename... ValTy>
   explicit AvlTreeNode(ValTy &&... V) : Value(std::forward<ValTy>(V)...) {}
-
-  ~AvlTreeNode() { Value.~Ty(); }
 };
 
 template <typename Ty> struct TreeTraits<AvlTreeNode<Ty>> {
@@ -83,7 +83,8 @@ template <typename Ty> struct TreeTraits<AvlTreeNode<Ty>> {
   static reference GetValue(node_pointer_type Node) { return Node->Value; }
 };
 
-template <typename Ty, typename AllocatorTy = Allocator> class BSTAvlImpl {
+template <typename Ty, typename AllocatorTy = Allocator>
+class BSTAvlImpl : private AllocatorHolder<AllocatorTy> {
 public:
   using node_type = AvlTreeNode<Ty>;
   using node_ptr = AvlTreeNode<Ty> *;
@@ -92,16 +93,23 @@ public:
   using value_compare = Less<Ty>;
 
   using al_ = AllocatorTy;
+  using holder_ = AllocatorHolder<AllocatorTy>;
 
 public:
   BSTAvlImpl() : root_(nullptr), size_(0) {}
 
+  explicit BSTAvlImpl(const AllocatorTy &Al)
+      : holder_(Al), root_(nullptr), size_(0) {}
+
   BSTAvlImpl(BSTAvlImpl &&Another)
-      : root_(Another.root_), size_(Another.size_) {
+      : holder_(std::move(Another.GetAllocator())), root_(Another.root_),
+        size_(Another.size_) {
     Another.root_ = nullptr;
     Another.size_ = 0;
   }
 
+  ~BSTAvlImpl() { clear(); }
+
   iterator insert(const Ty &Value) {
     node_ptr new_node = NewNode(Value);
     root_ = InsertImpl(root_, new_node);
@@ -141,18 +149,16 @@ public:
   }
 
   iterator erase(iterator Where) {
-    iterator it = Where++;
-    RemoveImpl(it.data());
+    node_ptr node = Where.data();
+    /// ӽʱ̵ֵᱻƶǰУǰ㼴Ϊһλ
+    if (!node->Left() || !node->Right())
+      ++Where;
+    RemoveImpl(node);
     --size_;
     return Where;
   }
 
-  iterator erase(const_iterator Where) {
-    iterator it = Where._Remove_Const()++;
-    RemoveImpl(it.data());
-    --size_;
-    return Where._Remove_Const();
-  }
+  iterator erase(const_iterator Where) { return erase(Where._Remove_Const()); }
 
   size_t count(const Ty &Value) const {
     if (find(Value) != end())
@@ -162,6 +168,8 @@ public:
 
   bool empty() const { return size_ == 0; }
 
+  al_ get_allocator() const { return this->GetAllocator(); }
+
   iterator begin() {
     assert(size_ != 0);
     node_ptr node = root_;
@@ -192,19 +200,21 @@ public:
   }
 
   void clear() {
-    Stack<node_ptr> bfs;
+    if (!root_)
+      return;
+    /// AVL߶ΪO(logN)ջеĽ٣ʹ洢ڴ
+    Stack<node_ptr, Allocator, SmallVector<node_ptr, 64>> bfs;
     bfs.push(root_);
     while (bfs.size()) {
       node_ptr top = bfs.top();
+      bfs.pop();
       if (top->Left())
         bfs.push(top->Left());
       if (top->Right())
         bfs.push(top->Right());
-      bfs.pop();
-      Replace(top, nullptr, top->Parent);
-      top->~AvlTreeNode();
-      al_::Deallocate(top);
+      DeleteNode(top);
     }
+    root_ = nullptr;
     size_ = 0;
   }
 
@@ -277,7 +287,8 @@ private:
   void Replace(node_ptr Old, node_ptr New, node_ptr Parent) {
     if (Parent == nullptr) {
       root_ = New;
-      root_->Parent = nullptr;
+      if (root_)
+        root_->Parent = nullptr;
       return;
     }
     if (Old == Parent->Left()) {
@@ -300,6 +311,7 @@ private:
         Replace(parent, new_head, old_parent);
         parent = old_parent;
       }
+      DeleteNode(Element);
     } else if (Element->Right() == nullptr) {
       /// ôɾӽڵ滻ɾ
       Replace(Element, Element->Left(), Element->Parent);
@@ -310,6 +322,7 @@ private:
         Replace(parent, new_head, old_parent);
         parent = old_parent;
       }
+      DeleteNode(Element);
     } else {
       /// ҵɾĺ̽ڵ
       node_ptr succ = Element->Right();
@@ -392,12 +405,19 @@ private:
 
   /// @brief µĽ
   template <typename... ValTy> node_ptr NewNode(ValTy &&... Value) {
-    node_ptr new_node = (node_ptr)al_::Allocate(sizeof(node_type));
+    node_ptr new_node =
+        (node_ptr)this->GetAllocator().Allocate(sizeof(node_type));
     ::new (new_node) node_type(std::forward<ValTy>(Value)...);
     new_node->Height = 1;
     return new_node;
   }
 
+  /// @brief ٲͷһ
+  void DeleteNode(node_ptr Node) {
+    Node->~AvlTreeNode();
+    this->GetAllocator().Deallocate(Node, sizeof(node_type));
+  }
+
 private:
   node_ptr root_;
   size_t size_;
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <memory>
+#include <string.h>
+#include <type_traits>
 
 namespace adt {
 
@@ -11,6 +13,22 @@ template <class Ty> void Swap(Ty &a, Ty &b) {
   b = std::move(temp);
 }
 
+/// @brief [First,Last)ԪذᵽδʼDestԭλõԪ
+/// ƽƵֱmemcpyƶ첻쳣(߲ܸ)ʱƶ
+template <class Ty> void Relocate(Ty *First, Ty *Last, Ty *Dest) {
+  if constexpr (std::is_trivially_copyable<Ty>::value) {
+    if (First != Last)
+      memcpy((void *)Dest, (const void *)First, (Last - First) * sizeof(Ty));
+  } else {
+    if constexpr (std::is_nothrow_move_constructible<Ty>::value ||
+                  !std::is_copy_constructible<Ty>::value)
+      std::uninitialized_move(First, Last, Dest);
+    else
+      std::uninitialized_copy(First, Last, Dest);
+    std::destroy(First, Last);
+  }
+}
+
 /// @brief Ƚcomperator
 template <class _Ty> struct Less {
   constexpr bool operator()(const _Ty &_Left, const _Ty &_Right) const {
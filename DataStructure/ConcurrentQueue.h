@@ -0,0 +1,507 @@
+/**
+ * ConcurrentQueue: ̰߳ȫн
+ * SpscQueue: ߵζ
+ * ȡΪ2ݣֻдtail_ֻдhead_ͨacquire/release
+ * ͬԪصĹҪκCAS
+ * ߻һhead_ֻлʾʱ¶ȡͬtail_
+ * 󲿷ֲֻԼڻеݣ˵CacheLineSize
+ * α
+ * 
+ *	try_push/try_emplace	ʱfalse
+ *	try_pop					пʱfalse
+ *	push_n/pop_n			/ȡֻһ±
+ * MpmcQueue: ߶ζ
+ * ÿλһţߺ߷ֱCASռenqueue_pos_dequeue_pos_
+ * λúֻԼĲλͨλŷԪأûȫ
+ * λŵposʱд룬pos+1ʱԶȡȡһ֡
+ * push/popԣȻʧʱߣ
+ * ֻдߵ߳ʱż֪ͨ
+ * 
+ *	try_push/try_emplace	ʱfalse
+ *	try_pop					пʱfalse
+ *	push					ʱ
+ *	pop						пʱ
+ * MultiQueue: ɳڵĲȶ
+ * c*PԼPriorityQueueɣʱѡһƬ
+ * ȡʱѡƬȽ϶ѶӽŵķƬȡ(two-choice)
+ * ֻʹtry_lockռõķƬֱӻһԣ֮߳ٻȴ
+ * ȡĲһȫŵԪأ(ȡԪظŵʣԪظ)
+ * ΪO(Ƭ)Ԫ޹ء
+ * 
+ *	push/emplace			Ԫ
+ *	try_pop					зƬΪʱfalse
+ **/
+#pragma once
+
+#include "Allocator.h"
+#include "Queue.h"
+#include <assert.h>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdint.h>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace adt {
+
+template <typename Ty, typename AllocatorTy = Allocator>
+class SpscQueue : private AllocatorHolder<AllocatorTy> {
+public:
+  using value_type = Ty;
+  using reference = Ty &;
+  using const_reference = const Ty &;
+
+  using al_ = AllocatorTy;
+  using holder_ = AllocatorHolder<AllocatorTy>;
+
+public:
+  /// @brief:CapacityԪصĶ
+  explicit SpscQueue(size_t Capacity, const AllocatorTy &Al = AllocatorTy())
+      : holder_(Al) {
+    size_t capacity = 2;
+    while (capacity < Capacity)
+      capacity *= 2;
+    mask_ = capacity - 1;
+    buffer_ = (Ty *)AllocatorTraits<al_>::AllocateBuffer(
+        this->GetAllocator(), capacity * sizeof(Ty), alignof(Ty));
+  }
+
+  SpscQueue(const SpscQueue &) = delete;
+  SpscQueue &operator=(const SpscQueue &) = delete;
+
+  ~SpscQueue() {
+    size_t tail = tail_.load(std::memory_order_relaxed);
+    for (size_t i = head_.load(std::memory_order_relaxed); i != tail; ++i)
+      std::destroy_at(&buffer_[i & mask_]);
+    AllocatorTraits<al_>::DeallocateBuffer(
+        this->GetAllocator(), buffer_, capacity() * sizeof(Ty), alignof(Ty));
+  }
+
+  /// ·ֻߵ
+
+  bool try_push(const Ty &Element) { return try_emplace(Element); }
+  bool try_push(Ty &&Element) { return try_emplace(std::move(Element)); }
+
+  template <typename... ValTy> bool try_emplace(ValTy &&... Value) {
+    size_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail - cached_head_ > mask_) {
+      cached_head_ = head_.load(std::memory_order_acquire);
+      if (tail - cached_head_ > mask_)
+        return false;
+    }
+    ::new (&buffer_[tail & mask_]) Ty(std::forward<ValTy>(Value)...);
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  /// @brief:FirstʼCountԪأʵʷĸ
+  template <typename Iterator> size_t push_n(Iterator First, size_t Count) {
+    size_t tail = tail_.load(std::memory_order_relaxed);
+    size_t free = capacity() - (tail - cached_head_);
+    if (free < Count) {
+      cached_head_ = head_.load(std::memory_order_acquire);
+      free = capacity() - (tail - cached_head_);
+    }
+    size_t count = Count < free ? Count : free;
+    for (size_t i = 0; i < count; ++i, ++First)
+      ::new (&buffer_[(tail + i) & mask_]) Ty(*First);
+    if (count)
+      tail_.store(tail + count, std::memory_order_release);
+    return count;
+  }
+
+  /// ·ֻߵ
+
+  bool try_pop(Ty &Out) {
+    size_t head = head_.load(std::memory_order_relaxed);
+    if (head == cached_tail_) {
+      cached_tail_ = tail_.load(std::memory_order_acquire);
+      if (head == cached_tail_)
+        return false;
+    }
+    Ty &slot = buffer_[head & mask_];
+    Out = std::move(slot);
+    std::destroy_at(&slot);
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  /// @brief:ȡCountԪдDestʵȡĸ
+  template <typename OutIterator> size_t pop_n(OutIterator Dest, size_t Count) {
+    size_t head = head_.load(std::memory_order_relaxed);
+    size_t ready = cached_tail_ - head;
+    if (ready < Count) {
+      cached_tail_ = tail_.load(std::memory_order_acquire);
+      ready = cached_tail_ - head;
+    }
+    size_t count = Count < ready ? Count : ready;
+    for (size_t i = 0; i < count; ++i, ++Dest) {
+      Ty &slot = buffer_[(head + i) & mask_];
+      *Dest = std::move(slot);
+      std::destroy_at(&slot);
+    }
+    if (count)
+      head_.store(head + count, std::memory_order_release);
+    return count;
+  }
+
+  /// ·̵߳ã޸ʱֻǽֵ
+
+  size_t size() const {
+    size_t head = head_.load(std::memory_order_acquire);
+    size_t tail = tail_.load(std::memory_order_acquire);
+    return tail - head <= capacity() ? tail - head : 0;
+  }
+
+  bool empty() const { return size() == 0; }
+  size_t capacity() const { return mask_ + 1; }
+
+private:
+  /// д߶
+  alignas(CacheLineSize) std::atomic<size_t> tail_{0};
+  /// ˽УѾȡߵλõĻ
+  size_t cached_head_ = 0;
+
+  /// д߶
+  alignas(CacheLineSize) std::atomic<size_t> head_{0};
+  /// ˽УѾλõĻ
+  size_t cached_tail_ = 0;
+
+  /// ֻ
+  alignas(CacheLineSize) Ty *buffer_ = nullptr;
+  size_t mask_ = 0;
+};
+
+template <typename Ty, typename AllocatorTy = Allocator>
+class MpmcQueue : private AllocatorHolder<AllocatorTy> {
+public:
+  using value_type = Ty;
+  using reference = Ty &;
+  using const_reference = const Ty &;
+
+  using al_ = AllocatorTy;
+  using holder_ = AllocatorHolder<AllocatorTy>;
+
+  /// ֮ǰԴ
+  static constexpr size_t SpinCount = 64;
+
+public:
+  /// @brief:CapacityԪصĶ
+  explicit MpmcQueue(size_t Capacity, const AllocatorTy &Al = AllocatorTy())
+      : holder_(Al) {
+    size_t capacity = 2;
+    while (capacity < Capacity)
+      capacity *= 2;
+    mask_ = capacity - 1;
+    cells_ = (Cell *)AllocatorTraits<al_>::AllocateBuffer(
+        this->GetAllocator(), capacity * sizeof(Cell), alignof(Cell));
+    for (size_t i = 0; i < capacity; ++i)
+      ::new (&cells_[i].Sequence) std::atomic<size_t>(i);
+  }
+
+  MpmcQueue(const MpmcQueue &) = delete;
+  MpmcQueue &operator=(const MpmcQueue &) = delete;
+
+  /// @brief:ʣԪأʱ̷߳ʶ
+  ~MpmcQueue() {
+    size_t tail = enqueue_pos_.load(std::memory_order_relaxed);
+    for (size_t i = dequeue_pos_.load(std::memory_order_relaxed); i != tail;
+         ++i) {
+      Cell &cell = cells_[i & mask_];
+      if (cell.Sequence.load(std::memory_order_relaxed) == i + 1)
+        std::destroy_at(cell.Data());
+    }
+    AllocatorTraits<al_>::DeallocateBuffer(this->GetAllocator(), cells_,
+                                           capacity() * sizeof(Cell),
+                                           alignof(Cell));
+  }
+
+  bool try_push(const Ty &Element) { return try_emplace(Element); }
+  bool try_push(Ty &&Element) { return try_emplace(std::move(Element)); }
+
+  template <typename... ValTy> bool try_emplace(ValTy &&... Value) {
+    if (!TryEmplace(std::forward<ValTy>(Value)...))
+      return false;
+    Notify(pop_waiters_, not_empty_);
+    return true;
+  }
+
+  bool try_pop(Ty &Out) {
+    if (!TryPop(Out))
+      return false;
+    Notify(push_waiters_, not_full_);
+    return true;
+  }
+
+  /// @brief:Ԫأʱ
+  void push(const Ty &Element) { emplace(Element); }
+  void push(Ty &&Element) { emplace(std::move(Element)); }
+
+  template <typename... ValTy> void emplace(ValTy &&... Value) {
+    for (size_t spin = 0;; ++spin) {
+      if (try_emplace(std::forward<ValTy>(Value)...))
+        return;
+      if (spin < SpinCount)
+        std::this_thread::yield();
+      else
+        Park(push_waiters_, not_full_, [this] { return !Full(); });
+    }
+  }
+
+  /// @brief:ȡԪأпʱ
+  void pop(Ty &Out) {
+    for (size_t spin = 0;; ++spin) {
+      if (try_pop(Out))
+        return;
+      if (spin < SpinCount)
+        std::this_thread::yield();
+      else
+        Park(pop_waiters_, not_empty_, [this] { return !Empty(); });
+    }
+  }
+
+  /// @brief:Ԫظ޸ʱֻǽֵ
+  size_t size() const {
+    size_t head = dequeue_pos_.load(std::memory_order_acquire);
+    size_t tail = enqueue_pos_.load(std::memory_order_acquire);
+    return tail - head <= capacity() ? tail - head : 0;
+  }
+
+  bool empty() const { return size() == 0; }
+  size_t capacity() const { return mask_ + 1; }
+
+private:
+  struct Cell {
+    std::atomic<size_t> Sequence;
+    alignas(Ty) unsigned char Storage[sizeof(Ty)];
+
+    Ty *Data() { return (Ty *)Storage; }
+  };
+
+  template <typename... ValTy> bool TryEmplace(ValTy &&... Value) {
+    size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+    Cell *cell;
+    while (true) {
+      cell = &cells_[pos & mask_];
+      size_t seq = cell->Sequence.load(std::memory_order_acquire);
+      ptrdiff_t diff = (ptrdiff_t)(seq - pos);
+      if (diff == 0) {
+        if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                               std::memory_order_relaxed))
+          break;
+      } else if (diff < 0) {
+        /// λлһֵԪأ
+        return false;
+      } else {
+        pos = enqueue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+    ::new (cell->Data()) Ty(std::forward<ValTy>(Value)...);
+    cell->Sequence.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool TryPop(Ty &Out) {
+    size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+    Cell *cell;
+    while (true) {
+      cell = &cells_[pos & mask_];
+      size_t seq = cell->Sequence.load(std::memory_order_acquire);
+      ptrdiff_t diff = (ptrdiff_t)(seq - (pos + 1));
+      if (diff == 0) {
+        if (dequeue_pos_.compare_exchange_weak(pos, pos + 1,
+                                               std::memory_order_relaxed))
+          break;
+      } else if (diff < 0) {
+        /// λûбд룬Ϊ
+        return false;
+      } else {
+        pos = dequeue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+    Out = std::move(*cell->Data());
+    std::destroy_at(cell->Data());
+    cell->Sequence.store(pos + mask_ + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool Full() const {
+    size_t tail = enqueue_pos_.load(std::memory_order_seq_cst);
+    return tail - dequeue_pos_.load(std::memory_order_seq_cst) >= capacity();
+  }
+
+  bool Empty() const {
+    size_t head = dequeue_pos_.load(std::memory_order_seq_cst);
+    return enqueue_pos_.load(std::memory_order_seq_cst) == head;
+  }
+
+  /// @brief:ǼΪȴߺټNotifyеդԣ֪ͨ
+  template <typename Pred>
+  void Park(std::atomic<size_t> &Waiters, std::condition_variable &Cond,
+            Pred Ready) {
+    Waiters.fetch_add(1, std::memory_order_seq_cst);
+    {
+      std::unique_lock<std::mutex> lock(park_lock_);
+      Cond.wait(lock, Ready);
+    }
+    Waiters.fetch_sub(1, std::memory_order_relaxed);
+  }
+
+  /// @brief:߳ڵȴʱһ
+  void Notify(std::atomic<size_t> &Waiters, std::condition_variable &Cond) {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (Waiters.load(std::memory_order_relaxed) == 0)
+      return;
+    /// ֪ͨȴ߼ʼ֮ǰ֪ͨ
+    { std::lock_guard<std::mutex> guard(park_lock_); }
+    Cond.notify_one();
+  }
+
+private:
+  alignas(CacheLineSize) std::atomic<size_t> enqueue_pos_{0};
+  alignas(CacheLineSize) std::atomic<size_t> dequeue_pos_{0};
+
+  /// ֻ
+  alignas(CacheLineSize) Cell *cells_ = nullptr;
+  size_t mask_ = 0;
+
+  /// ʹãֻдڵȴʱŻ
+  alignas(CacheLineSize) std::atomic<size_t> push_waiters_{0};
+  std::atomic<size_t> pop_waiters_{0};
+  std::mutex park_lock_;
+  std::condition_variable not_full_;
+  std::condition_variable not_empty_;
+};
+
+template <typename Ty, typename AllocatorTy = Allocator,
+          typename CompareTy = Less<Ty>>
+class MultiQueue {
+public:
+  using value_type = Ty;
+  using reference = Ty &;
+  using const_reference = const Ty &;
+  using value_compare = CompareTy;
+
+  using al_ = AllocatorTy;
+  using heap_type = PriorityQueue<Ty, AllocatorTy, 4, CompareTy>;
+
+public:
+  /// @brief:NumThreads*FactorƬ
+  explicit MultiQueue(size_t NumThreads = std::thread::hardware_concurrency(),
+                      size_t Factor = 2,
+                      const value_compare &Pred = value_compare())
+      : less_(Pred) {
+    size_t count = (NumThreads ? NumThreads : 1) * (Factor ? Factor : 1);
+    if (count < 2)
+      count = 2;
+    for (size_t i = 0; i < count; ++i)
+      shards_.emplace_back(new Shard(Pred));
+  }
+
+  MultiQueue(const MultiQueue &) = delete;
+  MultiQueue &operator=(const MultiQueue &) = delete;
+
+  void push(const Ty &Element) { emplace(Element); }
+  void push(Ty &&Element) { emplace(std::move(Element)); }
+
+  /// @brief:ѡķƬƬռʱһ
+  template <typename... ValTy> void emplace(ValTy &&... Value) {
+    while (true) {
+      Shard &shard = *shards_[Random() % shards_.size()];
+      std::unique_lock<std::mutex> lock(shard.Lock, std::try_to_lock);
+      if (!lock.owns_lock())
+        continue;
+      shard.Heap.emplace(std::forward<ValTy>(Value)...);
+      shard.Size.store(shard.Heap.size(), std::memory_order_relaxed);
+      return;
+    }
+  }
+
+  /// @brief:ѡƬȡнŵĶѶ
+  /// ûȡԪʱμзƬȫΪʱfalse
+  bool try_pop(Ty &Out) {
+    size_t count = shards_.size();
+    for (size_t attempt = 0; attempt < 2 * count; ++attempt) {
+      Shard *first = shards_[Random() % count].get();
+      Shard *second = shards_[Random() % count].get();
+      if (first->Size.load(std::memory_order_relaxed) == 0)
+        std::swap(first, second);
+      if (first->Size.load(std::memory_order_relaxed) == 0)
+        continue;
+      std::unique_lock<std::mutex> first_lock(first->Lock, std::try_to_lock);
+      if (!first_lock.owns_lock())
+        continue;
+      std::unique_lock<std::mutex> second_lock;
+      if (second != first &&
+          second->Size.load(std::memory_order_relaxed) != 0) {
+        second_lock = std::unique_lock<std::mutex>(second->Lock,
+                                                   std::try_to_lock);
+        if (!second_lock.owns_lock())
+          continue;
+      }
+      Shard *best = first;
+      if (second_lock.owns_lock() && !second->Heap.empty() &&
+          (first->Heap.empty() ||
+           less_(first->Heap.top(), second->Heap.top())))
+        best = second;
+      if (best->Heap.empty())
+        continue;
+      PopFrom(*best, Out);
+      return true;
+    }
+    for (std::unique_ptr<Shard> &shard : shards_) {
+      std::lock_guard<std::mutex> guard(shard->Lock);
+      if (!shard->Heap.empty()) {
+        PopFrom(*shard, Out);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /// @brief:Ԫظ޸ʱֻǽֵ
+  size_t size() const {
+    size_t total = 0;
+    for (const std::unique_ptr<Shard> &shard : shards_)
+      total += shard->Size.load(std::memory_order_relaxed);
+    return total;
+  }
+
+  bool empty() const { return size() == 0; }
+  size_t shard_count() const { return shards_.size(); }
+
+private:
+  struct alignas(CacheLineSize) Shard {
+    std::mutex Lock;
+    heap_type Heap;
+    /// ʱ£ڲշƬ
+    std::atomic<size_t> Size{0};
+
+    explicit Shard(const value_compare &Pred) : Heap(Pred) {}
+  };
+
+  void PopFrom(Shard &From, Ty &Out) {
+    From.Heap.pop(Out);
+    From.Size.store(From.Heap.size(), std::memory_order_relaxed);
+  }
+
+  /// @brief:ÿ̶߳xorshift
+  static size_t Random() {
+    thread_local uint64_t state =
+        std::hash<std::thread::id>()(std::this_thread::get_id()) | 1;
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return (size_t)state;
+  }
+
+private:
+  std::vector<std::unique_ptr<Shard>> shards_;
+  value_compare less_;
+};
+
+} // namespace adt
\ No newline at end of file
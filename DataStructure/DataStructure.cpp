@@ -1,23 +1,47 @@
 ﻿// DataStructure.cpp : 此文件包含 "main" 函数。程序执行将在此处开始并结束。
 //
 
+#include "ArenaAllocator.h"
 #include "BST.h"
+#include "ConcurrentQueue.h"
+#include "Deque.h"
+#include "IntrusiveList.h"
 #include "List.h"
+#include "MmapAllocator.h"
+#include "MmapVector.h"
+#include "Parallel.h"
+#include "PoolAllocator.h"
 #include "Queue.h"
+#include "SegmentedVector.h"
 #include "Set.h"
+#include "SimdAlgo.h"
 #include "SkipList.h"
+#include "SmallVector.h"
 #include "SortAlgo.h"
 #include "Stack.h"
+#include "ThreadCacheAllocator.h"
+#include "TrackingAllocator.h"
 #include "UnionFind.h"
 #include "UnorderedSet.h"
 #include "UnorderdMap.h"
+#include "UnrolledList.h"
 #include "Vector.h"
 #include <algorithm>
+#include <assert.h>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
 #include <iostream>
 #include <list>
+#include <mutex>
+#include <numeric>
 #include <queue>
+#include <random>
 #include <set>
 #include <stack>
+#include <string>
+#include <string.h>
+#include <thread>
 #include <unordered_set>
 #include <unordered_map>
 
@@ -35,6 +59,47 @@ public:
   int b_;
 };
 
+template <typename Al> void check_aligned(Al &Allocator, size_t Alignment) {
+  using traits = adt::AllocatorTraits<Al>;
+  for (size_t size = 0; size < 1024; size += 37) {
+    char *buffer = traits::Allocate(Allocator, size, Alignment);
+    assert(((uintptr_t)buffer & (Alignment - 1)) == 0);
+    memset(buffer, 0xcc, size);
+    traits::Deallocate(Allocator, buffer, size, Alignment);
+  }
+}
+
+void test_aligned_allocation() {
+  adt::Allocator plain;
+  check_aligned(plain, 64);
+  check_aligned(plain, 4096);
+
+  /// 不提供对齐接口的分配器由AllocatorTraits多分配后手动对齐
+  adt::PoolAllocator<> pool;
+  check_aligned(pool, 64);
+  check_aligned(pool, 256);
+
+  /// chunk大小不是Alignment的倍数时，末尾剩余空间也不能破坏对齐
+  for (size_t chunk_size : {100, 1000, 4096}) {
+    adt::Arena arena(chunk_size);
+    for (size_t i = 0; i < 1000; ++i) {
+      size_t alignment = (size_t)64 << (i % 4);
+      char *buffer = arena.Allocate((i * 37) % 300, alignment);
+      assert(((uintptr_t)buffer & (alignment - 1)) == 0);
+      memset(buffer, 0xcc, (i * 37) % 300);
+    }
+  }
+
+  adt::MmapAllocator<> mmap;
+  check_aligned(mmap, 64);
+  const size_t huge = 3 * adt::MmapAllocator<>::HugePageSize;
+  char *buffer = mmap.Allocate(huge, 4096);
+  assert(((uintptr_t)buffer & 4095) == 0);
+  memset(buffer, 0xcc, huge);
+  mmap.Deallocate(buffer, huge, 4096);
+  std::cout << "aligned allocation ok" << std::endl;
+}
+
 void test_vector() {
   adt::Vector<int> vt;
 
@@ -89,6 +154,99 @@ void test_vector() {
   v3.dump();
 }
 
+void test_segmented_vector() {
+  adt::SegmentedVector<int, 16> sv;
+  for (int i = 0; i < 1000; ++i)
+    sv.push_back(i);
+
+  /// 扩展时不搬动元素，已有元素的地址保持不变
+  int *first = &sv[0];
+  int *middle = &sv[500];
+  for (int i = 1000; i < 5000; ++i)
+    sv.push_back(i);
+  assert(first == &sv[0] && *middle == 500 && middle == &sv[500]);
+
+  /// 作为队列使用：头部弹出、尾部放入交替进行，跨越大量块边界
+  int expected = 0;
+  for (int i = 5000; i < 50000; ++i) {
+    sv.push_back(i);
+    assert(sv.front() == expected);
+    sv.pop_front();
+    ++expected;
+  }
+  assert(sv.size() == 5000 && sv.front() == expected);
+  assert(sv.back() == 49999);
+
+  int value = expected;
+  for (adt::SegmentedVector<int, 16>::iterator it = sv.begin(); it != sv.end();
+       ++it)
+    assert(*it == value++);
+  assert(sv.end() - sv.begin() == 5000 && sv[4999] == 49999);
+
+  while (sv.size() > 10)
+    sv.pop_back();
+  while (!sv.empty())
+    sv.pop_front();
+  for (int i = 0; i < 40; ++i)
+    sv.push_back(i);
+  assert(sv.front() == 0 && sv.back() == 39);
+
+  adt::SegmentedVector<int, 16> copy(sv);
+  adt::SegmentedVector<int, 16> moved(std::move(sv));
+  assert(copy.size() == 40 && moved.size() == 40 && copy[17] == moved[17]);
+  std::cout << "segmented vector ok" << std::endl;
+}
+
+void test_mmap_vector() {
+  const char *path = "mmap_vector_test.bin";
+  std::remove(path);
+  {
+    adt::MmapVector<uint64_t> mv(path);
+    assert(mv.size() == 0);
+    for (uint64_t i = 0; i < 100000; ++i)
+      mv.push_back(i * i);
+    mv.flush();
+  }
+  {
+    /// 重新打开时只校验文件头，元素直接来自文件
+    adt::MmapVector<uint64_t> mv(path);
+    assert(mv.size() == 100000);
+    for (uint64_t i = 0; i < 100000; i += 999)
+      assert(mv[i] == i * i);
+    mv.resize(10);
+    mv.shrink_to_fit();
+  }
+  {
+    adt::MmapVector<uint64_t> mv(path);
+    assert(mv.size() == 10 && mv[9] == 81);
+    /// 文件已满，扩展时映射会移动，参数引用旧映射中的元素
+    assert(mv.capacity() == mv.size());
+    mv.push_back(mv[9]);
+    assert(mv[10] == 81);
+  }
+
+  /// 元素大小不一致和文件过小都应拒绝，且不泄漏文件句柄
+  for (int i = 0; i < 4096; ++i) {
+    try {
+      adt::MmapVector<uint32_t> mv(path);
+      assert(false);
+    } catch (const std::runtime_error &e) {
+      assert(std::string(e.what()) == "MmapVector: header mismatch");
+    }
+  }
+  FILE *file = fopen(path, "wb");
+  fputs("short", file);
+  fclose(file);
+  try {
+    adt::MmapVector<uint64_t> mv(path);
+    assert(false);
+  } catch (const std::runtime_error &e) {
+    assert(std::string(e.what()) == "MmapVector: file is too small");
+  }
+  std::remove(path);
+  std::cout << "mmap vector ok" << std::endl;
+}
+
 void test_list() {
   adt::List<int> vt;
 
@@ -154,6 +312,104 @@ void test_list() {
   v3.dump();
 }
 
+struct CachePage {
+  int id;
+  adt::IntrusiveListHook lru;
+  adt::IntrusiveListHook dirty;
+};
+
+void test_intrusive_list() {
+  using lru_list = adt::IntrusiveList<CachePage, offsetof(CachePage, lru)>;
+  using dirty_list = adt::IntrusiveList<CachePage, offsetof(CachePage, dirty)>;
+  CachePage pages[8];
+  lru_list lru;
+  dirty_list dirty;
+  for (int i = 0; i < 8; ++i) {
+    pages[i].id = i;
+    lru.push_back(pages[i]);
+    if (i % 2)
+      dirty.push_front(pages[i]);
+  }
+  assert(lru.size() == 8 && dirty.size() == 4);
+  assert(lru.front().id == 0 && dirty.front().id == 7);
+
+  /// 同一个对象同时挂在两个链表上，从一个链表摘下不影响另一个
+  lru.remove(pages[3]);
+  assert(!pages[3].lru.is_linked() && pages[3].dirty.is_linked());
+  lru.push_back(pages[3]);
+  assert(lru.back().id == 3 && lru.size() == 8);
+
+  /// LRU：访问过的页移到尾部，淘汰头部
+  lru.splice(lru.end(), lru, lru.iterator_to(pages[0]));
+  assert(lru.front().id == 1 && lru.back().id == 0);
+  lru.pop_front();
+  assert(!pages[1].lru.is_linked() && lru.size() == 7);
+
+  int ids[] = {2, 4, 5, 6, 7, 3, 0};
+  int n = 0;
+  for (lru_list::iterator it = lru.begin(); it != lru.end(); ++it)
+    assert(it->id == ids[n++]);
+
+  dirty_list flushed(std::move(dirty));
+  assert(dirty.empty() && flushed.size() == 4);
+  for (dirty_list::iterator it = flushed.begin(); it != flushed.end();)
+    it = flushed.erase(it);
+  for (CachePage &page : pages)
+    assert(!page.dirty.is_linked());
+  lru.clear();
+  std::cout << "intrusive list ok" << std::endl;
+}
+
+void test_deque() {
+  adt::Deque<std::string> dq;
+  for (int i = 0; i < 10; ++i) {
+    dq.push_back(std::to_string(i));
+    dq.push_front(std::to_string(-i));
+  }
+  /// 扩容时环形的两段元素都要按顺序搬到新缓冲区
+  assert(dq.size() == 20 && dq.front() == "-9" && dq.back() == "9");
+  for (int i = 0; i < 20; ++i)
+    assert(dq[i] == std::to_string(i < 10 ? i - 9 : i - 10));
+  assert(dq.end() - dq.begin() == 20);
+
+  dq.pop_front();
+  dq.pop_back();
+  assert(dq.front() == "-8" && dq.back() == "8");
+  adt::Deque<std::string> copy(dq);
+  adt::Deque<std::string> moved(std::move(dq));
+  assert(copy.size() == 18 && moved.size() == 18 && copy[5] == moved[5]);
+
+  /// 队列已满时参数引用队列中的元素，扩容释放旧缓冲区后参数仍然有效
+  while (copy.size() < copy.capacity())
+    copy.push_back(std::string(32, 'a' + copy.size() % 26));
+  copy.push_back(copy.front());
+  assert(copy.back() == "-8");
+  while (copy.size() < copy.capacity())
+    copy.push_back(copy[1]);
+  copy.push_front(copy.back());
+  assert(copy.front() == copy[2]);
+  adt::Queue<std::string> strings;
+  for (int i = 0; i < 8; ++i)
+    strings.push(std::string(32, 'a' + i));
+  strings.push(strings.front());
+  assert(strings.size() == 9 && strings.front() == strings.back());
+
+  /// Queue默认以Deque为底层容器，容量稳定后反复放入和弹出不再分配内存
+  adt::AllocationStats stats;
+  adt::TrackingAllocator<> tracking(&stats);
+  adt::Queue<int, adt::TrackingAllocator<>> queue(tracking);
+  for (int i = 0; i < 100; ++i)
+    queue.push(i);
+  size_t allocations = stats.allocations();
+  for (int i = 100; i < 100000; ++i) {
+    queue.push(i);
+    assert(queue.front() == i - 100);
+    queue.pop();
+  }
+  assert(stats.allocations() == allocations && queue.size() == 100);
+  std::cout << "deque ok" << std::endl;
+}
+
 void test_priority_queue() {
   adt::PriorityQueue<int> pq;
   cout << "push 5" << endl;
@@ -209,6 +465,135 @@ void test_priority_queue() {
   cout << "top:" << pq.top() << endl;
 }
 
+/// 距离越小越优先，使IndexedPriorityQueue成为最小堆
+struct NearerFirst {
+  bool operator()(int Left, int Right) const { return Left > Right; }
+};
+
+void test_indexed_priority_queue() {
+  const int vertices = 200;
+  const int infinity = 1 << 30;
+  std::vector<std::vector<int>> weight(vertices,
+                                       std::vector<int>(vertices, infinity));
+  std::mt19937 rng(7);
+  for (int i = 0; i < vertices * 8; ++i)
+    weight[rng() % vertices][rng() % vertices] = (int)(rng() % 100) + 1;
+
+  /// 朴素的O(V^2)实现作为对照
+  std::vector<int> expected(vertices, infinity);
+  std::vector<bool> done(vertices, false);
+  expected[0] = 0;
+  for (int round = 0; round < vertices; ++round) {
+    int u = -1;
+    for (int v = 0; v < vertices; ++v)
+      if (!done[v] && (u < 0 || expected[v] < expected[u]))
+        u = v;
+    done[u] = true;
+    for (int v = 0; v < vertices; ++v)
+      if (weight[u][v] != infinity)
+        expected[v] = std::min(expected[v], expected[u] + weight[u][v]);
+  }
+
+  /// 依次放入时句柄即为顶点编号，松弛时通过promote减小距离
+  adt::IndexedPriorityQueue<int, adt::Allocator, 4, NearerFirst> pq;
+  for (int v = 0; v < vertices; ++v) {
+    size_t handle = pq.push(v == 0 ? 0 : infinity);
+    assert(handle == (size_t)v);
+  }
+  std::vector<int> dist(vertices, infinity);
+  while (!pq.empty()) {
+    int u = (int)pq.top_handle();
+    dist[u] = pq.top();
+    pq.pop();
+    if (dist[u] == infinity)
+      continue;
+    for (int v = 0; v < vertices; ++v) {
+      if (!pq.contains(v) || weight[u][v] == infinity)
+        continue;
+      int candidate = dist[u] + weight[u][v];
+      if (candidate < pq.get(v))
+        pq.promote(v, candidate);
+    }
+  }
+  assert(dist == expected);
+
+  adt::IndexedPriorityQueue<int> heap;
+  size_t a = heap.push(10), b = heap.push(20);
+  heap.push(15);
+  heap.demote(b, 5);
+  assert(heap.top() == 15);
+  heap.update(b, 30);
+  assert(heap.top() == 30 && heap.top_handle() == b);
+  heap.erase(b);
+  assert(!heap.contains(b) && heap.contains(a) && heap.size() == 2);
+  std::cout << "indexed priority queue ok" << std::endl;
+}
+
+void test_radix_heap() {
+  /// 事件队列：取出的时间单调不减，新事件的时间不早于当前时间
+  adt::RadixHeap<uint32_t, int> events;
+  std::priority_queue<uint32_t, std::vector<uint32_t>, std::greater<uint32_t>>
+      reference;
+  std::mt19937 rng(11);
+  for (int i = 0; i < 1000; ++i) {
+    uint32_t time = rng() % 100000;
+    events.push(time, i);
+    reference.push(time);
+  }
+  uint32_t now = 0;
+  for (int i = 0; i < 20000 && !events.empty(); ++i) {
+    assert(events.top_key() == reference.top() && events.top_key() >= now);
+    now = events.top().first;
+    events.pop();
+    reference.pop();
+    if (i % 3 != 2) {
+      uint32_t time = now + rng() % 5000;
+      events.push(time, i);
+      reference.push(time);
+    }
+  }
+  assert(events.size() == reference.size());
+
+  adt::RadixHeap<uint32_t, int> copy(events);
+  adt::RadixHeap<uint32_t, int> moved(std::move(events));
+  assert(copy.size() == moved.size());
+  events.clear();
+  assert(events.empty());
+  while (!copy.empty()) {
+    assert(copy.top() == moved.top());
+    copy.pop();
+    moved.pop();
+  }
+
+  /// 只有键时与PriorityQueue的push/top/pop形式一致，取出顺序为从小到大
+  adt::RadixHeap<uint64_t> keys;
+  uint64_t inputs[] = {40, 7, 7, 1000000000000ULL, 0, 63};
+  for (uint64_t key : inputs)
+    keys.push(key);
+  adt::RadixHeap<uint64_t> assigned;
+  assigned = keys;
+  uint64_t expected[] = {0, 7, 7, 40, 63, 1000000000000ULL};
+  for (uint64_t key : expected) {
+    assert(assigned.top() == key);
+    assigned.pop();
+  }
+  assert(assigned.empty() && keys.size() == 6);
+
+  /// 空堆不分配内存，所有桶都使用传入的分配器
+  using TrackedHeap =
+      adt::RadixHeap<uint64_t, uint64_t, adt::TrackingAllocator<>>;
+  adt::AllocationStats stats;
+  adt::TrackingAllocator<> tracking(&stats);
+  TrackedHeap tracked(tracking);
+  assert(stats.allocations() == 0);
+  for (uint64_t i = 0; i < 1000; ++i)
+    tracked.push(rng() % 1000000, i);
+  assert(stats.allocations() > 0);
+  while (!tracked.empty())
+    tracked.pop();
+  std::cout << "radix heap ok" << std::endl;
+}
+
 void dump_set(adt::Set<int> &set) {
   std::cout << "<";
   for (adt::Set<int>::iterator iter = set.begin(); iter != set.end(); ++iter)
@@ -261,6 +646,34 @@ void test_set() {
   adt::Set<int> avl3 = adt::Set<int>(std::move(avl));
 }
 
+void test_set_erase() {
+  adt::Set<int> avl;
+  for (int i = 0; i < 64; ++i)
+    avl.insert(i);
+
+  /// 通过常量迭代器删除偶数，返回值应指向下一个元素
+  const adt::Set<int> &view = avl;
+  adt::Set<int>::const_iterator it = view.begin();
+  while (it != view.end()) {
+    int value = *it;
+    if (value % 2 == 0) {
+      adt::Set<int>::iterator next = avl.erase(it);
+      it = adt::Set<int>::const_iterator(next.data());
+      assert(it == view.end() || *it == value + 1);
+    } else {
+      ++it;
+    }
+  }
+
+  int expected = 1;
+  for (adt::Set<int>::iterator iter = avl.begin(); iter != avl.end(); ++iter) {
+    assert(*iter == expected);
+    expected += 2;
+  }
+  assert(expected == 65);
+  std::cout << "set erase by const_iterator ok" << std::endl;
+}
+
 void dump_skip_list(adt::SkipList<int> &sl) {
   std::cout << "<";
   for (adt::SkipList<int>::iterator iter = sl.begin(); iter != sl.end(); ++iter)
@@ -315,16 +728,911 @@ void test_unordered_map() {
   um.find(5);
 }
 
-int main() {
+struct ArenaTestTag {};
+
+void test_arena_allocator() {
+  using arena_allocator = adt::ArenaAllocator<ArenaTestTag, 4096>;
+  adt::Arena &arena = arena_allocator::GetArena();
+  {
+    adt::List<int, arena_allocator> list;
+    adt::Vector<int, arena_allocator> vec;
+    for (int i = 0; i < 10000; ++i) {
+      list.push_back(i);
+      vec.push_back(i);
+    }
+    assert(list.size() == 10000 && list.back() == 9999 && vec[5000] == 5000);
+  }
+  assert(arena.reserved() > 0);
+  arena_allocator::Reset();
+  assert(arena.reserved() == 0);
+
+  /// 同一个chunk内的小块内存按Alignment连续切分
+  adt::Arena local(4096);
+  char *first = local.Allocate(10);
+  char *second = local.Allocate(16);
+  assert(second == first + adt::Arena::Alignment);
+  local.Deallocate(first, 10);
+  /// 放不下的大块内存单独占用chunk，不打断当前chunk的切分
+  char *large = local.Allocate(5000);
+  char *third = local.Allocate(1);
+  assert(third == second + 16 && large != nullptr);
+  std::cout << "arena allocator ok" << std::endl;
+}
+
+struct PoolTestTag {};
+
+void test_pool_allocator() {
+  /// 释放的内存块挂回对应等级的空闲链表，下次同等级的分配直接复用
+  adt::Pool pool(4096);
+  char *first = pool.Allocate(24);
+  pool.Deallocate(first, 24);
+  assert(pool.Allocate(32) == first);
+  char *large = pool.Allocate(adt::Pool::MaxSmallSize + 1);
+  pool.Deallocate(large, adt::Pool::MaxSmallSize + 1);
+
+  using pool_allocator = adt::PoolAllocator<PoolTestTag, 4096>;
+  adt::List<std::string, pool_allocator> list;
+  for (int round = 0; round < 3; ++round) {
+    for (int i = 0; i < 1000; ++i)
+      list.push_back(std::to_string(i));
+    assert(list.size() == 1000 && list.back() == "999");
+    list.clear();
+  }
+  pool_allocator::Release();
+  std::cout << "pool allocator ok" << std::endl;
+}
+
+void test_allocator_instance() {
+  /// 无状态分配器通过空基类优化不占用容器空间
+  static_assert(sizeof(adt::Vector<int>) == 3 * sizeof(void *),
+                "stateless allocator should not take space");
+
+  adt::Arena first, second;
+  adt::ResourceAllocator on_first(&first), on_second(&second);
+  adt::Vector<int, adt::ResourceAllocator> vec(on_first);
+  adt::List<int, adt::ResourceAllocator> list(on_second);
+  for (int i = 0; i < 1000; ++i) {
+    vec.push_back(i);
+    list.push_back(i);
+  }
+  assert(vec.get_allocator() == on_first && list.get_allocator() == on_second);
+  size_t reserved = second.reserved();
+  assert(first.reserved() > 0 && reserved > 0);
+
+  /// 复制和移动时带上原容器的分配器
+  adt::Vector<int, adt::ResourceAllocator> copy(vec);
+  adt::List<int, adt::ResourceAllocator> moved(std::move(list));
+  assert(copy.get_allocator().resource() == &first);
+  assert(moved.get_allocator().resource() == &second);
+  assert(second.reserved() == reserved && moved.size() == 1000);
+
+  adt::Vector<int, adt::ResourceAllocator> fallback;
+  fallback.push_back(1);
+  assert(fallback.get_allocator().resource() == adt::NewDeleteResource::Get());
+  std::cout << "allocator instance ok" << std::endl;
+}
+
+void test_thread_cache_allocator() {
+  /// 一半内存块在生产线程分配、在消费线程释放，经由Depot在线程之间流转
+  const size_t threads = 4;
+  const size_t blocks = 20000;
+  std::vector<std::vector<char *>> handoff(threads);
+  std::vector<std::thread> workers;
+  for (size_t t = 0; t < threads; ++t)
+    workers.emplace_back([&, t] {
+      adt::List<int, adt::ThreadCacheAllocator> local;
+      for (size_t i = 0; i < blocks; ++i) {
+        size_t size = 8 + (i % 64) * 8;
+        char *block = adt::ThreadCacheAllocator::Allocate(size);
+        memset(block, (int)t, size);
+        if (i % 2)
+          handoff[t].push_back(block);
+        else
+          adt::ThreadCacheAllocator::Deallocate(block, size);
+        local.push_back((int)i);
+      }
+      assert(local.size() == blocks);
+    });
+  for (std::thread &worker : workers)
+    worker.join();
+  workers.clear();
+  for (size_t t = 0; t < threads; ++t)
+    workers.emplace_back([&, t] {
+      std::vector<char *> &owned = handoff[(t + 1) % threads];
+      for (size_t i = 0; i < owned.size(); ++i) {
+        size_t size = 8 + ((2 * i + 1) % 64) * 8;
+        assert(owned[i][size - 1] == (char)((t + 1) % threads));
+        adt::ThreadCacheAllocator::Deallocate(owned[i], size);
+      }
+    });
+  for (std::thread &worker : workers)
+    worker.join();
+  std::cout << "thread cache allocator ok" << std::endl;
+}
+
+void test_tracking_allocator() {
+  adt::AllocationStats stats;
+  {
+    adt::TrackingAllocator<> tracking(&stats);
+    adt::Vector<int, adt::TrackingAllocator<>> vec(tracking);
+    for (int i = 0; i < 1000; ++i)
+      vec.push_back(i);
+    assert(stats.allocations() > 0 && stats.live_bytes() > 0);
+    assert(stats.peak_bytes() >= stats.live_bytes());
+    assert(stats.deallocations() == stats.allocations() - 1);
+  }
+  /// 容器析构后所有内存都已归还
+  assert(stats.live_bytes() == 0 &&
+         stats.bytes_allocated() == stats.bytes_freed());
+  size_t buckets = 0;
+  for (size_t i = 0; i < adt::AllocationStats::NumBuckets; ++i)
+    buckets += stats.histogram(i);
+  assert(buckets == stats.allocations());
+  stats.dump(std::cout, "tracking");
+
+  stats.reset();
+  assert(stats.allocations() == 0 && stats.peak_bytes() == 0);
+  std::cout << "tracking allocator ok" << std::endl;
+}
+
+/// 统计复制和移动次数的元素
+struct CountedElement {
+  static int copies;
+  static int moves;
+  int value;
+
+  CountedElement(int Value) : value(Value) {}
+  CountedElement(const CountedElement &Another) : value(Another.value) {
+    ++copies;
+  }
+  CountedElement(CountedElement &&Another) noexcept : value(Another.value) {
+    ++moves;
+  }
+  CountedElement &operator=(const CountedElement &) = default;
+  CountedElement &operator=(CountedElement &&) = default;
+};
+
+int CountedElement::copies = 0;
+int CountedElement::moves = 0;
+
+void test_vector_relocation() {
+  /// 移动构造不抛异常时扩容只移动不复制
+  adt::Vector<CountedElement> counted;
+  for (int i = 0; i < 1000; ++i)
+    counted.emplace_back(i);
+  assert(CountedElement::copies == 0 && CountedElement::moves > 0);
+  for (int i = 0; i < 1000; ++i)
+    assert(counted[i].value == i);
+
+  /// 只能移动的元素
+  adt::Vector<std::unique_ptr<int>> owners;
+  for (int i = 0; i < 1000; ++i)
+    owners.push_back(std::make_unique<int>(i));
+  assert(*owners[999] == 999);
+
+  /// 扩容后旧缓冲区立即释放，任何时刻只占用一个缓冲区
+  adt::AllocationStats stats;
+  adt::TrackingAllocator<> tracking(&stats);
+  adt::Vector<int, adt::TrackingAllocator<>> tracked(tracking);
+  for (int i = 0; i < 100000; ++i) {
+    tracked.push_back(i);
+    assert(stats.allocations() - stats.deallocations() == 1);
+  }
+
+  /// 参数引用当前向量中的元素时，扩容释放旧缓冲区后参数仍然有效
+  adt::Vector<std::string> strings;
+  while (strings.size() < strings.capacity())
+    strings.push_back(std::string(32, 'a' + strings.size() % 26));
+  strings.push_back(strings[0]);
+  assert(strings.back() == strings[0]);
+  while (strings.size() < strings.capacity())
+    strings.emplace_back(strings[1]);
+  strings.emplace_back(strings.back());
+  assert(strings.back() == strings[1]);
+  size_t old_size = strings.size();
+  strings.shrink_to_fit();
+  strings.append(strings.begin(), strings.end());
+  assert(strings.size() == old_size * 2);
+  for (size_t i = 0; i < old_size; ++i)
+    assert(strings[old_size + i] == strings[i]);
+  strings.shrink_to_fit();
+  strings.append(3, strings[2]);
+  assert(strings.back() == strings[2]);
+  strings.shrink_to_fit();
+  strings.resize(strings.size() * 2, strings[3]);
+  assert(strings.back() == strings[3]);
+
+  adt::SmallVector<std::string, 2> small;
+  small.push_back(std::string(32, 'x'));
+  small.push_back(std::string(32, 'y'));
+  small.push_back(small[0]);
+  assert(small.size() == 3 && small[2] == small[0]);
+  std::cout << "vector relocation ok" << std::endl;
+}
+
+void test_small_vector() {
+  /// 元素个数不超过N时不分配内存
+  adt::AllocationStats stats;
+  adt::TrackingAllocator<> tracking(&stats);
+  adt::SmallVector<std::string, 4, adt::TrackingAllocator<>> small(tracking);
+  for (int i = 0; i < 4; ++i)
+    small.push_back(std::to_string(i));
+  assert(small.is_small() && stats.allocations() == 0);
+
+  small.push_back("4");
+  assert(!small.is_small() && stats.allocations() == 1);
+  assert(small.size() == 5 && small[0] == "0" && small[4] == "4");
+
+  /// 复制和移动都要正确处理内联和堆上两种状态
+  adt::SmallVector<std::string, 4, adt::TrackingAllocator<>> copy(small);
+  adt::SmallVector<std::string, 4, adt::TrackingAllocator<>> moved(
+      std::move(small));
+  assert(copy.size() == 5 && moved.size() == 5 && copy[3] == moved[3]);
+
+  moved.resize(2);
+  moved.shrink_to_fit();
+  assert(moved.is_small() && moved[1] == "1");
+  adt::SmallVector<std::string, 4, adt::TrackingAllocator<>> inline_moved(
+      std::move(moved));
+  assert(inline_moved.is_small() && inline_moved.size() == 2);
+  std::cout << "small vector ok" << std::endl;
+}
+
+/// 逐个放入Count个元素，返回扩容(容量变化)的次数
+template <typename GrowthTy> size_t count_growths(size_t Count) {
+  adt::Vector<int, adt::Allocator, GrowthTy> vec;
+  size_t growths = 0, capacity = vec.capacity();
+  for (size_t i = 0; i < Count; ++i) {
+    vec.push_back((int)i);
+    if (vec.capacity() != capacity) {
+      assert(vec.capacity() > capacity && vec.capacity() >= vec.size());
+      capacity = vec.capacity();
+      ++growths;
+    }
+  }
+  return growths;
+}
+
+void test_vector_growth() {
+  /// 几何扩展的次数为对数级，固定增量的次数为线性
+  using doubling = adt::GeometricGrowth<2, 1>;
+  using one_and_half = adt::GeometricGrowth<3, 2>;
+  assert(count_growths<doubling>(100000) <= 16);
+  assert(count_growths<one_and_half>(100000) <= 28);
+  assert(count_growths<adt::FixedGrowth<1000>>(100000) == 100);
+
+  /// 按页扩展后缓冲区字节数总是页大小的整数倍(构造时的初始容量除外)
+  adt::Vector<double, adt::Allocator, adt::PageGrowth<4096>> paged;
+  size_t initial = paged.capacity();
+  for (int i = 0; i < 10000; ++i) {
+    paged.push_back(i);
+    assert(paged.capacity() == initial ||
+           paged.capacity() * sizeof(double) % 4096 == 0);
+  }
+  std::cout << "vector growth ok" << std::endl;
+}
+
+void test_vector_range_ops() {
+  /// 与std::vector对照，随机执行单个和区间的插入、删除
+  adt::Vector<std::string> vec;
+  std::vector<std::string> reference;
+  std::mt19937 rng(3);
+  for (int round = 0; round < 2000; ++round) {
+    size_t pos = reference.empty() ? 0 : rng() % (reference.size() + 1);
+    std::string value = std::to_string(round);
+    switch (rng() % 6) {
+    case 0:
+      vec.insert(vec.begin() + pos, value);
+      reference.insert(reference.begin() + pos, value);
+      break;
+    case 1:
+      vec.insert(vec.begin() + pos, (size_t)3, value);
+      reference.insert(reference.begin() + pos, (size_t)3, value);
+      break;
+    case 2: {
+      std::list<std::string> source(rng() % 5, value);
+      vec.insert(vec.begin() + pos, source.begin(), source.end());
+      reference.insert(reference.begin() + pos, source.begin(), source.end());
+      break;
+    }
+    case 3:
+      vec.emplace(vec.begin() + pos, 2, 'x');
+      reference.emplace(reference.begin() + pos, 2, 'x');
+      break;
+    default: {
+      if (pos == reference.size())
+        break;
+      size_t last = pos + rng() % std::min<size_t>(4, reference.size() - pos);
+      adt::Vector<std::string>::iterator it =
+          vec.erase(vec.begin() + pos, vec.begin() + last + 1);
+      reference.erase(reference.begin() + pos, reference.begin() + last + 1);
+      assert(it == vec.begin() + pos);
+      break;
+    }
+    }
+    assert(vec.size() == reference.size());
+  }
+  for (size_t i = 0; i < reference.size(); ++i)
+    assert(vec[i] == reference[i]);
+  std::cout << "vector range ops ok" << std::endl;
+}
+
+void test_simd_algo() {
+  /// 覆盖所有长度和起始偏移，检查向量主体和标量尾部的衔接
+  std::mt19937 rng(5);
+  std::vector<int32_t> ints(300);
+  std::vector<float> floats(300);
+  std::vector<unsigned char> bytes(300);
+  for (size_t i = 0; i < ints.size(); ++i) {
+    ints[i] = (int32_t)(rng() % 50) - 25;
+    floats[i] = (float)ints[i] * 0.5f;
+    bytes[i] = (unsigned char)(rng() % 40);
+  }
+  for (size_t offset = 0; offset < 9; ++offset) {
+    for (size_t length = 0; offset + length <= ints.size(); length += 7) {
+      const int32_t *first = ints.data() + offset, *last = first + length;
+      const float *ffirst = floats.data() + offset, *flast = ffirst + length;
+      const unsigned char *bfirst = bytes.data() + offset;
+      int32_t value = ints[(offset + length) % ints.size()];
+
+      assert(adt::simd::find(first, last, value) ==
+             std::find(first, last, value));
+      assert(adt::simd::count(first, last, value) ==
+             (size_t)std::count(first, last, value));
+      assert(adt::simd::min_element(first, last) ==
+             std::min_element(first, last));
+      assert(adt::simd::max_element(first, last) ==
+             std::max_element(first, last));
+      assert(adt::simd::accumulate(first, last) ==
+             std::accumulate(first, last, (int64_t)0));
+
+      float fvalue = (float)value * 0.5f;
+      assert(adt::simd::find(ffirst, flast, fvalue) ==
+             std::find(ffirst, flast, fvalue));
+      assert(adt::simd::min_element(ffirst, flast) ==
+             std::min_element(ffirst, flast));
+      assert(adt::simd::max_element(ffirst, flast) ==
+             std::max_element(ffirst, flast));
+      /// 元素都是0.5的整数倍，多路累加也没有舍入误差
+      assert(adt::simd::accumulate(ffirst, flast) ==
+             std::accumulate(ffirst, flast, 0.0));
+
+      assert(adt::simd::find_byte(bfirst, length, 7) ==
+             memchr(bfirst, 7, length));
+    }
+  }
+  std::cout << "simd algo ok" << std::endl;
+}
+
+void test_thread_pool() {
+  adt::ThreadPool pool(4);
+  std::vector<int> values(100000);
+  std::iota(values.begin(), values.end(), 0);
+
+  adt::parallel_for(
+      values.begin(), values.end(), [](int &value) { value *= 2; }, 0, pool);
+  for (size_t i = 0; i < values.size(); ++i)
+    assert(values[i] == 2 * (int)i);
+
+  int64_t sum = adt::parallel_reduce(
+      values.begin(), values.end(), (int64_t)0,
+      [](int64_t Left, int64_t Right) { return Left + Right; }, 0, pool);
+  assert(sum == std::accumulate(values.begin(), values.end(), (int64_t)0));
+
+  /// 只满足结合律、不满足交换律的归约也要保持顺序
+  std::vector<std::string> digits(2000);
+  for (size_t i = 0; i < digits.size(); ++i)
+    digits[i] = std::to_string(i % 10);
+  std::string joined = adt::parallel_reduce(
+      digits.begin(), digits.end(), std::string(),
+      [](const std::string &Left, const std::string &Right) {
+        return Left + Right;
+      },
+      64, pool);
+  assert(joined == std::accumulate(digits.begin(), digits.end(),
+                                   std::string()));
+
+  std::vector<int> squares(values.size());
+  adt::parallel_transform(
+      values.begin(), values.end(), squares.begin(),
+      [](int value) { return value % 1000 * (value % 1000); }, 0, pool);
+  assert(squares[12345] == 690 * 690);
+
+  /// 任务中嵌套调用并行算法，任务抛出的异常由wait重新抛出
+  std::atomic<int> visited{0};
+  adt::TaskGroup group(pool);
+  for (int t = 0; t < 8; ++t)
+    group.run([&] {
+      adt::parallel_for(
+          values.begin(), values.begin() + 1000,
+          [&](int &) { visited.fetch_add(1); }, 16, pool);
+    });
+  group.run([] { throw std::runtime_error("task failed"); });
+  bool thrown = false;
+  try {
+    group.wait();
+  } catch (const std::runtime_error &) {
+    thrown = true;
+  }
+  assert(thrown && visited.load() == 8000);
+  std::cout << "thread pool ok" << std::endl;
+}
+
+void test_unrolled_list() {
+  /// 与std::list对照，随机在两端和中间插入、删除，触发结点的拆分与合并
+  adt::UnrolledList<std::string, 8> list;
+  std::list<std::string> reference;
+  std::mt19937 rng(9);
+  for (int round = 0; round < 5000; ++round) {
+    std::string value = std::to_string(round);
+    size_t pos = reference.empty() ? 0 : rng() % reference.size();
+    adt::UnrolledList<std::string, 8>::iterator it = list.begin();
+    std::list<std::string>::iterator ref = reference.begin();
+    std::advance(it, pos);
+    std::advance(ref, pos);
+    switch (rng() % 6) {
+    case 0:
+      list.push_back(value);
+      reference.push_back(value);
+      break;
+    case 1:
+      list.push_front(value);
+      reference.push_front(value);
+      break;
+    case 2:
+    case 3:
+      /// 插入到it之后，与List一致
+      if (reference.empty()) {
+        list.emplace(list.end(), value);
+        reference.push_front(value);
+      } else {
+        std::string &inserted = *list.emplace(it, value);
+        assert(inserted == value);
+        reference.insert(std::next(ref), value);
+      }
+      break;
+    case 4:
+      if (!reference.empty()) {
+        list.remove(it);
+        reference.erase(ref);
+      }
+      break;
+    default:
+      if (!reference.empty()) {
+        list.pop_back();
+        reference.pop_back();
+      }
+      break;
+    }
+    assert(list.size() == reference.size());
+  }
+  assert(std::equal(list.begin(), list.end(), reference.begin(),
+                    reference.end()));
+
+  adt::UnrolledList<std::string, 8> copy(list);
+  adt::UnrolledList<std::string, 8> moved(std::move(list));
+  assert(list.empty() && copy.size() == moved.size());
+  assert(std::equal(copy.begin(), copy.end(), moved.begin(), moved.end()));
+  std::cout << "unrolled list ok" << std::endl;
+}
+
+/// 只比较键，用于检查merge和sort的稳定性
+struct KeyLess {
+  bool operator()(const std::pair<int, int> &Left,
+                  const std::pair<int, int> &Right) const {
+    return Left.first < Right.first;
+  }
+};
+
+void test_list_splice_sort() {
+  adt::List<int> list, other;
+  for (int i = 0; i < 5; ++i) {
+    list.push_back(i);
+    other.push_back(10 + i);
+  }
+  /// 单个结点、区间和整个链表都插到Where之前
+  adt::List<int>::iterator second = ++other.begin();
+  list.splice(list.begin(), other, second);
+  adt::List<int>::iterator first = other.begin(), last = other.begin();
+  std::advance(last, 2);
+  list.splice(list.end(), other, first, last);
+  assert(list.size() == 8 && other.size() == 2);
+  list.splice(++list.begin(), other);
+  assert(other.size() == 0 && list.size() == 10);
+  int spliced[] = {11, 13, 14, 0, 1, 2, 3, 4, 10, 12};
+  assert(std::equal(list.begin(), list.end(), std::begin(spliced)));
+
+  /// 自底向上排序只修改指针，元素地址不变，且相等元素保持原有顺序
+  adt::List<std::pair<int, int>> pairs;
+  std::vector<std::pair<int, int>> reference;
+  std::mt19937 rng(13);
+  for (int i = 0; i < 5000; ++i) {
+    pairs.push_back(std::make_pair((int)(rng() % 100), i));
+    reference.push_back(pairs.back());
+  }
+  const std::pair<int, int> *address = &pairs.front();
+  int front_order = pairs.front().second;
+  pairs.sort(KeyLess());
+  std::stable_sort(reference.begin(), reference.end(), KeyLess());
+  assert(std::equal(pairs.begin(), pairs.end(), reference.begin()));
+  for (const std::pair<int, int> &element : pairs)
+    if (element.second == front_order)
+      assert(&element == address);
+
+  adt::List<std::pair<int, int>> more;
+  for (int i = 0; i < 100; ++i)
+    more.push_back(std::make_pair(i, -i));
+  reference.insert(reference.end(), more.begin(), more.end());
+  std::stable_sort(reference.begin(), reference.end(), KeyLess());
+  pairs.merge(more, KeyLess());
+  assert(more.size() == 0 && pairs.size() == reference.size());
+  assert(std::equal(pairs.begin(), pairs.end(), reference.begin()));
+  std::cout << "list splice/merge/sort ok" << std::endl;
+}
+
+void test_spsc_queue() {
+  /// 容量向上取2的幂，满时放入失败，析构时销毁剩余元素
+  adt::SpscQueue<std::string> strings(5);
+  assert(strings.capacity() == 8);
+  for (int i = 0; i < 8; ++i) {
+    bool pushed = strings.try_push(std::to_string(i));
+    assert(pushed);
+  }
+  bool overflow = strings.try_push("overflow");
+  assert(!overflow && strings.size() == 8);
+  std::string out;
+  bool popped = strings.try_pop(out);
+  assert(popped && out == "0");
+
+  /// 生产者交替使用try_push和push_n，消费者交替使用try_pop和pop_n，
+  /// 元素按放入顺序到达
+  const int count = 200000;
+  adt::SpscQueue<int> queue(64);
+  std::thread producer([&queue]() {
+    int next = 0, batch[7];
+    while (next < count) {
+      if (next % 3 == 0) {
+        if (queue.try_push(next))
+          ++next;
+        continue;
+      }
+      int n = std::min(7, count - next);
+      for (int i = 0; i < n; ++i)
+        batch[i] = next + i;
+      next += (int)queue.push_n(batch, (size_t)n);
+    }
+  });
+  int expected = 0, batch[5];
+  while (expected < count) {
+    if (expected % 2 == 0) {
+      int value;
+      if (queue.try_pop(value)) {
+        assert(value == expected);
+        ++expected;
+      }
+      continue;
+    }
+    size_t n = queue.pop_n(batch, 5);
+    for (size_t i = 0; i < n; ++i, ++expected)
+      assert(batch[i] == expected);
+  }
+  producer.join();
+  assert(queue.empty());
+  std::cout << "spsc queue ok" << std::endl;
+}
+
+void test_mpmc_queue() {
+  adt::MpmcQueue<int> queue(8);
+  assert(queue.capacity() == 8);
+  for (int i = 0; i < 8; ++i) {
+    bool pushed = queue.try_push(i);
+    assert(pushed);
+  }
+  bool overflow = queue.try_push(8);
+  assert(!overflow);
+  for (int i = 0; i < 8; ++i) {
+    int value;
+    queue.pop(value);
+    assert(value == i);
+  }
+  assert(queue.empty());
+
+  /// 容量很小，阻塞的push/pop会进入休眠，每个元素恰好被取出一次，
+  /// 每个消费者看到的同一生产者的元素保持放入顺序
+  const int producers = 3, consumers = 3, per_producer = 30000;
+  std::vector<std::atomic<int>> seen(producers * per_producer);
+  for (std::atomic<int> &count : seen)
+    count = 0;
+  std::vector<std::thread> threads;
+  for (int p = 0; p < producers; ++p)
+    threads.emplace_back([&queue, p]() {
+      for (int i = 0; i < per_producer; ++i)
+        queue.push(p * per_producer + i);
+    });
+  for (int c = 0; c < consumers; ++c)
+    threads.emplace_back([&queue, &seen]() {
+      int last[producers] = {-1, -1, -1};
+      for (int i = 0; i < per_producer * producers / consumers; ++i) {
+        int value;
+        queue.pop(value);
+        int p = value / per_producer;
+        assert(value % per_producer > last[p]);
+        last[p] = value % per_producer;
+        seen[value].fetch_add(1, std::memory_order_relaxed);
+      }
+    });
+  for (std::thread &thread : threads)
+    thread.join();
+  assert(queue.empty());
+  for (const std::atomic<int> &count : seen)
+    assert(count.load() == 1);
+  std::cout << "mpmc queue ok" << std::endl;
+}
+
+/// 随机交替放入和弹出，与std::priority_queue逐步比较
+template <size_t Arity> void check_d_ary_heap() {
+  using Heap = adt::PriorityQueue<int, adt::Allocator, Arity>;
+  Heap heap;
+  assert(heap.size() == 0 && heap.empty());
+  std::priority_queue<int> reference;
+  std::mt19937 rng((unsigned)Arity);
+  for (int i = 0; i < 20000; ++i) {
+    if (rng() % 3 != 0 || reference.empty()) {
+      int value = (int)(rng() % 1000);
+      heap.push(value);
+      reference.push(value);
+    } else {
+      assert(heap.top() == reference.top());
+      heap.pop();
+      reference.pop();
+    }
+    assert(heap.size() == reference.size());
+  }
+
+  /// 复制和移动后size()仍不包含填充元素
+  Heap copy(heap);
+  Heap moved(std::move(heap));
+  assert(copy.size() == reference.size() && moved.size() == reference.size());
+  assert(heap.size() == 0 && heap.empty());
+  while (!reference.empty()) {
+    int top;
+    moved.pop(top);
+    assert(top == reference.top() && copy.top() == top);
+    copy.pop();
+    reference.pop();
+  }
+  assert(moved.empty() && copy.empty());
+}
+
+void test_d_ary_heap() {
+  check_d_ary_heap<2>();
+  check_d_ary_heap<4>();
+  check_d_ary_heap<8>();
+  std::cout << "d-ary heap ok" << std::endl;
+}
+
+/// 统计比较次数，用于检查建堆是线性的
+static size_t heap_compare_count = 0;
+
+struct CountingLess {
+  bool operator()(int Left, int Right) const {
+    ++heap_compare_count;
+    return Left < Right;
+  }
+};
+
+/// 依次弹出堆中所有元素，与降序排列的reference比较
+template <typename HeapTy>
+bool drain_matches(HeapTy &Heap, std::vector<int> Reference) {
+  std::sort(Reference.begin(), Reference.end(), std::greater<int>());
+  for (int expected : Reference) {
+    if (Heap.empty() || Heap.top() != expected)
+      return false;
+    Heap.pop();
+  }
+  return Heap.empty();
+}
+
+void test_heap_push_range() {
+  using Heap = adt::PriorityQueue<int, adt::Allocator, 4, CountingLess>;
+  std::mt19937 rng(23);
+  std::vector<int> values(100000);
+  for (int &value : values)
+    value = (int)(rng() % 50000);
+
+  /// 区间构造和初始化列表构造
+  Heap built(values.begin(), values.end());
+  assert(built.size() == values.size());
+  bool drained = drain_matches(built, values);
+  assert(drained);
+  Heap listed{3, 9, 1, 9, 4};
+  drained = drain_matches(listed, std::vector<int>{3, 9, 1, 9, 4});
+  assert(drained);
+
+  /// 新增元素较少时逐个上浮，较多时整体重建，两种情况结果都正确
+  Heap heap(values.begin(), values.begin() + 50000);
+  heap.push_range(values.begin() + 50000, values.begin() + 50100);
+  heap.push_range(values.begin() + 50100, values.end());
+  assert(heap.size() == values.size());
+  drained = drain_matches(heap, values);
+  assert(drained);
+
+  /// 升序输入时逐个上浮每次都到达堆顶，Floyd建堆的比较次数仍是线性的
+  std::vector<int> ascending(values.size());
+  std::iota(ascending.begin(), ascending.end(), 0);
+  heap_compare_count = 0;
+  Heap sorted(ascending.begin(), ascending.end());
+  assert(heap_compare_count < 3 * ascending.size());
+  Heap grown{-1};
+  heap_compare_count = 0;
+  grown.push_range(ascending.begin(), ascending.end());
+  assert(heap_compare_count < 3 * ascending.size());
+  assert(sorted.top() == (int)ascending.size() - 1);
+  assert(grown.top() == sorted.top());
+  std::cout << "heap push_range ok" << std::endl;
+}
+
+/// 秩误差：取出元素时，队列中比它更优的元素个数
+/// 放入0到Count-1的乱序排列后全部取出，用树状数组统计每次取出时剩余的更大元素
+void multi_queue_rank_error(size_t Count, size_t Shards) {
+  adt::MultiQueue<int> mq(Shards, 1);
+  std::vector<int> keys(Count);
+  for (size_t i = 0; i < Count; ++i)
+    keys[i] = (int)i;
+  std::shuffle(keys.begin(), keys.end(), std::mt19937(42));
+  for (int key : keys)
+    mq.push(key);
+
+  /// tree中记录还在队列中的元素
+  std::vector<int> tree(Count + 1, 0);
+  for (size_t i = 1; i <= Count; ++i) {
+    tree[i] += 1;
+    size_t parent = i + (i & (0 - i));
+    if (parent <= Count)
+      tree[parent] += tree[i];
+  }
+  size_t total = 0, worst = 0, remaining = Count;
+  int key;
+  while (mq.try_pop(key)) {
+    size_t not_greater = 0;
+    for (size_t i = key + 1; i > 0; i -= i & (0 - i))
+      not_greater += tree[i];
+    size_t rank = remaining - not_greater;
+    total += rank;
+    worst = std::max(worst, rank);
+    for (size_t i = key + 1; i <= Count; i += i & (0 - i))
+      tree[i] -= 1;
+    --remaining;
+  }
+  std::cout << "shards=" << mq.shard_count()
+            << " mean rank error=" << (double)total / Count
+            << " max rank error=" << worst << std::endl;
+}
+
+/// 吞吐量：每个线程交替放入和取出，与一个锁保护的PriorityQueue对比
+template <typename Func> double benchmark_ops(size_t Threads, Func Body) {
+  auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> workers;
+  for (size_t t = 0; t < Threads; ++t)
+    workers.emplace_back(Body, t);
+  for (std::thread &worker : workers)
+    worker.join();
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return elapsed.count();
+}
+
+void test_multi_queue() {
+  /// 多个线程同时放入和取出，每个元素恰好被取出一次
+  const size_t threads = 4;
+  const int per_thread = 5000;
+  adt::MultiQueue<int> mq(threads);
+  std::vector<std::vector<int>> popped(threads);
+  std::vector<std::thread> workers;
+  for (size_t t = 0; t < threads; ++t)
+    workers.emplace_back([&, t] {
+      int value;
+      for (int i = 0; i < per_thread; ++i) {
+        mq.push((int)t * per_thread + i);
+        if (i % 2 && mq.try_pop(value))
+          popped[t].push_back(value);
+      }
+    });
+  for (std::thread &worker : workers)
+    worker.join();
+  std::vector<int> all;
+  for (std::vector<int> &values : popped)
+    all.insert(all.end(), values.begin(), values.end());
+  int value;
+  while (mq.try_pop(value))
+    all.push_back(value);
+  std::sort(all.begin(), all.end());
+  assert(all.size() == threads * per_thread && mq.empty());
+  for (size_t i = 0; i < all.size(); ++i)
+    assert(all[i] == (int)i);
+
+  multi_queue_rank_error(10000, 1);
+  multi_queue_rank_error(10000, 8);
+  std::cout << "multi queue ok" << std::endl;
+}
+
+/// 吞吐量对比，耗时较长，只在命令行参数为--bench时运行
+void benchmark_multi_queue() {
+  multi_queue_rank_error(100000, 4);
+  multi_queue_rank_error(100000, 16);
+
+  const size_t threads =
+      std::max<size_t>(2, std::thread::hardware_concurrency());
+  const size_t ops = 200000;
+
+  adt::MultiQueue<int> mq(threads);
+  double mq_time = benchmark_ops(threads, [&](size_t t) {
+    std::mt19937 rng((unsigned)t);
+    int value;
+    for (size_t i = 0; i < ops; ++i) {
+      mq.push((int)rng());
+      mq.try_pop(value);
+    }
+  });
+
+  std::mutex lock;
+  adt::PriorityQueue<int> pq;
+  double pq_time = benchmark_ops(threads, [&](size_t t) {
+    std::mt19937 rng((unsigned)t);
+    for (size_t i = 0; i < ops; ++i) {
+      std::lock_guard<std::mutex> guard(lock);
+      pq.push((int)rng());
+      pq.pop();
+    }
+  });
+
+  double total = 2.0 * ops * threads;
+  std::cout << "threads=" << threads
+            << " MultiQueue: " << total / mq_time / 1e6 << " Mops/s"
+            << " locked PriorityQueue: " << total / pq_time / 1e6 << " Mops/s"
+            << std::endl;
+}
+
+int main(int argc, char *argv[]) {
+  if (argc > 1 && std::string(argv[1]) == "--bench") {
+    benchmark_multi_queue();
+    return 0;
+  }
 
   std::priority_queue<int> zz;
   std::vector<int> aa;
   std::list<int> k;
   std::stack<int> st = std::stack<int>();
   std::unordered_map<int, int> um;
+  test_aligned_allocation();
+  test_segmented_vector();
+  test_mmap_vector();
+  test_intrusive_list();
+  test_deque();
+  test_arena_allocator();
+  test_pool_allocator();
+  test_allocator_instance();
+  test_thread_cache_allocator();
+  test_tracking_allocator();
+  test_vector_relocation();
+  test_small_vector();
+  test_vector_growth();
+  test_vector_range_ops();
+  test_simd_algo();
+  test_thread_pool();
+  test_unrolled_list();
+  test_list_splice_sort();
+  test_spsc_queue();
+  test_mpmc_queue();
+  test_d_ary_heap();
+  test_heap_push_range();
   test_priority_queue();
+  test_indexed_priority_queue();
+  test_radix_heap();
   test_set();
+  test_set_erase();
   test_unionfind();
+  test_multi_queue();
 
   adt::SkipList<int> sl;
   int i = 10000;
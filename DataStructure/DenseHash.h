@@ -96,7 +96,7 @@ private:
 
 template <typename BucketTy, typename BucketTraits, typename AllocatorTy,
           typename HashTraits = Hashable<typename BucketTraits::keyTy>>
-class DenseHash {
+class DenseHash : private AllocatorHolder<AllocatorTy> {
 public:
   using keyTy = typename BucketTraits::keyTy;
   using iterator = HashIterator<BucketTy>;
@@ -106,6 +106,7 @@ public:
   using entry_iteartor = typename HashEntry<BucketTy> *;
 
   using al_ = AllocatorTy;
+  using holder_ = AllocatorHolder<AllocatorTy>;
 
 public:
   DenseHash() {
@@ -113,6 +114,11 @@ public:
     num_buckets_ = 32;
   }
 
+  explicit DenseHash(const AllocatorTy &Al) : holder_(Al) {
+    buckets_ = AllocBucketBufferAndCotor(32);
+    num_buckets_ = 32;
+  }
+
 public:
   iterator insert(const BucketTy &Value) {
     TryGrow();
@@ -208,6 +214,8 @@ public:
 
   float load_factor() { return 1.0 * 3 / 4; }
 
+  al_ get_allocator() const { return this->GetAllocator(); }
+
 protected:
   unsigned GetNumEntries() { return num_entries_; }
   unsigned GetNumBuckets() { return num_buckets_; }
@@ -215,7 +223,8 @@ protected:
   unsigned Hash(const keyTy &Key) { return HashTraits::hash(Key); }
 
   entry *AllocBucketBufferAndCotor(size_t Size) {
-    entry *Buffer = (entry *)al_::Allocate(Size * sizeof(entry));
+    entry *Buffer = (entry *)AllocatorTraits<al_>::AllocateBuffer(
+        this->GetAllocator(), Size * sizeof(entry), alignof(entry));
     std::uninitialized_fill_n(Buffer, Size, entry());
     return Buffer;
   }
@@ -231,7 +240,9 @@ protected:
         insert(OldBuckets[i].Value);
     }
     std::destroy(OldBuckets, OldBuckets + OldBucketCount);
-    al_::Deallocate(OldBuckets);
+    AllocatorTraits<al_>::DeallocateBuffer(this->GetAllocator(), OldBuckets,
+                                           OldBucketCount * sizeof(entry),
+                                           alignof(entry));
   }
 
   void TryGrow() {
@@ -278,8 +289,8 @@ protected:
   entry_iteartor BucketEnd() const { return buckets_ + num_buckets_; }
 
 protected:
-  size_t num_entries_;
-  size_t num_tombstones_;
+  size_t num_entries_ = 0;
+  size_t num_tombstones_ = 0;
   size_t num_buckets_;
   entry *buckets_;
 };
@@ -0,0 +1,355 @@
+/**
+ * Deque: ڻλ˫˶
+ * ԪΪ2ݵĻУhead_¼һԪصλã
+ * ±ͨƣ˵ķ͵Ǿ̯O(1)ʱͷڴ档
+ * ʱԪذ˳ᵽ»Ŀͷ
+ * ΪQueueĬϵײ͵ʱá
+ * 
+ *	push_back/push_front		β/ͷԪ
+ *	pop_back/pop_front			β/ͷԪ
+ *	front/back					ͷ/βԪ
+ *	reserve						֤СCount
+ *	clear						Ԫأ
+ **/
+#pragma once
+
+#include "Allocator.h"
+#include "Basis.h"
+#include <algorithm>
+#include <assert.h>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+namespace adt {
+
+/// @brief:λʵValueTyΪconst Tyʱǳ
+template <typename ValueTy> class DequeIterator {
+public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = std::remove_const_t<ValueTy>;
+  using pointer = ValueTy *;
+  using reference = ValueTy &;
+  using difference_type = ptrdiff_t;
+
+public:
+  DequeIterator() : data_(nullptr), mask_(0), pos_(0) {}
+
+  DequeIterator(pointer Data, size_t Mask, size_t Pos)
+      : data_(Data), mask_(Mask), pos_(Pos) {}
+
+  /// @brief:ǳתΪ
+  template <typename OtherTy, typename = std::enable_if_t<
+                                  std::is_same<const OtherTy, ValueTy>::value>>
+  DequeIterator(const DequeIterator<OtherTy> &Another)
+      : data_(Another.data()), mask_(Another.mask()), pos_(Another.pos()) {}
+
+  reference operator*() const { return data_[pos_ & mask_]; }
+
+  pointer operator->() const { return &**this; }
+
+  reference operator[](difference_type Offset) const {
+    return *(*this + Offset);
+  }
+
+  DequeIterator &operator++() {
+    ++pos_;
+    return *this;
+  }
+
+  DequeIterator &operator--() {
+    --pos_;
+    return *this;
+  }
+
+  const DequeIterator operator++(int) {
+    DequeIterator it = *this;
+    ++*this;
+    return it;
+  }
+
+  const DequeIterator operator--(int) {
+    DequeIterator it = *this;
+    --*this;
+    return it;
+  }
+
+  DequeIterator &operator+=(difference_type Offset) {
+    pos_ += Offset;
+    return *this;
+  }
+
+  DequeIterator &operator-=(difference_type Offset) {
+    pos_ -= Offset;
+    return *this;
+  }
+
+  DequeIterator operator+(difference_type Offset) const {
+    return DequeIterator(data_, mask_, pos_ + Offset);
+  }
+
+  DequeIterator operator-(difference_type Offset) const {
+    return DequeIterator(data_, mask_, pos_ - Offset);
+  }
+
+  difference_type operator-(const DequeIterator &Another) const {
+    return (difference_type)(pos_ - Another.pos_);
+  }
+
+  bool operator==(const DequeIterator &Another) const {
+    return pos_ == Another.pos_;
+  }
+
+  bool operator!=(const DequeIterator &Another) const {
+    return pos_ != Another.pos_;
+  }
+
+  bool operator<(const DequeIterator &Another) const {
+    return *this - Another < 0;
+  }
+
+  bool operator>(const DequeIterator &Another) const {
+    return *this - Another > 0;
+  }
+
+  bool operator<=(const DequeIterator &Another) const {
+    return *this - Another <= 0;
+  }
+
+  bool operator>=(const DequeIterator &Another) const {
+    return *this - Another >= 0;
+  }
+
+  pointer data() const { return data_; }
+  size_t mask() const { return mask_; }
+  size_t pos() const { return pos_; }
+
+private:
+  pointer data_;
+  size_t mask_;
+  /// δƵλãʱmask_
+  size_t pos_;
+};
+
+template <typename Ty, typename AllocatorTy = Allocator>
+class Deque : private AllocatorHolder<AllocatorTy> {
+public:
+  using value_type = Ty;
+  using reference = Ty &;
+  using const_reference = const Ty &;
+  using pointer = Ty *;
+  using const_pointer = const Ty *;
+  using iterator = DequeIterator<Ty>;
+  using const_iterator = DequeIterator<const Ty>;
+
+  using al_ = AllocatorTy;
+  using holder_ = AllocatorHolder<AllocatorTy>;
+
+public:
+  Deque() {}
+
+  explicit Deque(const AllocatorTy &Al) : holder_(Al) {}
+
+  Deque(std::initializer_list<Ty> InitList,
+        const AllocatorTy &Al = AllocatorTy())
+      : holder_(Al) {
+    reserve(InitList.size());
+    for (const Ty &element : InitList)
+      emplace_back(element);
+  }
+
+  Deque(const Deque &Another) : holder_(Another.GetAllocator()) {
+    reserve(Another.size_);
+    for (const_iterator it = Another.begin(); it != Another.end(); ++it)
+      emplace_back(*it);
+  }
+
+  Deque(Deque &&Another)
+      : holder_(std::move(Another.GetAllocator())), data_(Another.data_),
+        head_(Another.head_), size_(Another.size_),
+        capacity_(Another.capacity_) {
+    Another.data_ = nullptr;
+    Another.head_ = Another.size_ = Another.capacity_ = 0;
+  }
+
+  ~Deque() {
+    clear();
+    DeallocateBuffer(data_, capacity_);
+  }
+
+  Deque &operator=(const Deque &Right) {
+    if (this == &Right)
+      return *this;
+    clear();
+    reserve(Right.size_);
+    for (const_iterator it = Right.begin(); it != Right.end(); ++it)
+      emplace_back(*it);
+    return *this;
+  }
+
+  Deque &operator=(Deque &&Right) {
+    if (this == &Right)
+      return *this;
+    clear();
+    DeallocateBuffer(data_, capacity_);
+    this->GetAllocator() = std::move(Right.GetAllocator());
+    data_ = Right.data_;
+    head_ = Right.head_;
+    size_ = Right.size_;
+    capacity_ = Right.capacity_;
+    Right.data_ = nullptr;
+    Right.head_ = Right.size_ = Right.capacity_ = 0;
+    return *this;
+  }
+
+  size_t size() const { return size_; }
+  size_t capacity() const { return capacity_; }
+  bool empty() const { return size_ == 0; }
+
+  al_ get_allocator() const { return this->GetAllocator(); }
+
+  iterator begin() { return iterator(data_, Mask(), head_); }
+  iterator end() { return iterator(data_, Mask(), head_ + size_); }
+  const_iterator begin() const { return const_iterator(data_, Mask(), head_); }
+  const_iterator end() const {
+    return const_iterator(data_, Mask(), head_ + size_);
+  }
+
+  reference operator[](size_t Idx) {
+    assert(Idx < size_);
+    return At(head_ + Idx);
+  }
+
+  const_reference operator[](size_t Idx) const {
+    assert(Idx < size_);
+    return At(head_ + Idx);
+  }
+
+  reference front() {
+    assert(size_ > 0);
+    return At(head_);
+  }
+
+  const_reference front() const {
+    assert(size_ > 0);
+    return At(head_);
+  }
+
+  reference back() {
+    assert(size_ > 0);
+    return At(head_ + size_ - 1);
+  }
+
+  const_reference back() const {
+    assert(size_ > 0);
+    return At(head_ + size_ - 1);
+  }
+
+  void push_back(const Ty &Element) { emplace_back(Element); }
+  void push_back(Ty &&Element) { emplace_back(std::move(Element)); }
+  void push_front(const Ty &Element) { emplace_front(Element); }
+  void push_front(Ty &&Element) { emplace_front(std::move(Element)); }
+
+  template <typename... ValTy> reference emplace_back(ValTy &&... Value) {
+    if (size_ == capacity_) {
+      /// õǰеԪأչͷžɻȹչ
+      Ty element(std::forward<ValTy>(Value)...);
+      grow(size_ + 1);
+      return emplace_back(std::move(element));
+    }
+    Ty *slot = &At(head_ + size_);
+    ::new (slot) Ty(std::forward<ValTy>(Value)...);
+    ++size_;
+    return *slot;
+  }
+
+  template <typename... ValTy> reference emplace_front(ValTy &&... Value) {
+    if (size_ == capacity_) {
+      /// õǰеԪأչͷžɻȹչ
+      Ty element(std::forward<ValTy>(Value)...);
+      grow(size_ + 1);
+      return emplace_front(std::move(element));
+    }
+    size_t head = (head_ - 1) & Mask();
+    Ty *slot = &At(head);
+    ::new (slot) Ty(std::forward<ValTy>(Value)...);
+    head_ = head;
+    ++size_;
+    return *slot;
+  }
+
+  void pop_back() {
+    assert(size_ > 0);
+    --size_;
+    std::destroy_at(&At(head_ + size_));
+  }
+
+  void pop_front() {
+    assert(size_ > 0);
+    std::destroy_at(&At(head_));
+    head_ = (head_ + 1) & Mask();
+    --size_;
+  }
+
+  /// @brief:Ԫأ
+  void clear() {
+    if constexpr (!std::is_trivially_destructible<Ty>::value)
+      for (size_t i = 0; i < size_; ++i)
+        std::destroy_at(&At(head_ + i));
+    head_ = size_ = 0;
+  }
+
+  /// @brief:֤СCount
+  void reserve(size_t Count) {
+    if (Count > capacity_)
+      grow(Count);
+  }
+
+private:
+  size_t Mask() const { return capacity_ - 1; }
+
+  Ty &At(size_t Pos) const { return data_[Pos & Mask()]; }
+
+  /// @brief:CountԪصĻ
+  Ty *AllocateBuffer(size_t Count) {
+    return (Ty *)AllocatorTraits<al_>::AllocateBuffer(
+        this->GetAllocator(), Count * sizeof(Ty), alignof(Ty));
+  }
+
+  /// @brief:ͷAllocateBufferĻ
+  void DeallocateBuffer(Ty *Buffer, size_t Count) {
+    if (!Buffer)
+      return;
+    AllocatorTraits<al_>::DeallocateBuffer(
+        this->GetAllocator(), Buffer, Count * sizeof(Ty), alignof(Ty));
+  }
+
+  /// @brief:չСSize2ݣεԪذ˳ᵽ»ͷ
+  void grow(size_t Size) {
+    size_t new_cap = capacity_ ? capacity_ : 8;
+    while (new_cap < Size)
+      new_cap *= 2;
+
+    Ty *new_data = AllocateBuffer(new_cap);
+    if (size_) {
+      size_t first = std::min(size_, capacity_ - head_);
+      Relocate(data_ + head_, data_ + head_ + first, new_data);
+      Relocate(data_, data_ + (size_ - first), new_data + first);
+    }
+    DeallocateBuffer(data_, capacity_);
+    data_ = new_data;
+    head_ = 0;
+    capacity_ = new_cap;
+  }
+
+private:
+  Ty *data_ = nullptr;
+  /// һԪڻе±꣬Сcapacity_
+  size_t head_ = 0;
+  size_t size_ = 0;
+  /// Ϊ02
+  size_t capacity_ = 0;
+};
+
+} // namespace adt
\ No newline at end of file
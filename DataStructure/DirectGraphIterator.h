@@ -1,5 +1,6 @@
 #pragma once
 
+#include "SmallVector.h"
 #include "Stack.h"
 #include <map>
 
@@ -39,7 +40,7 @@ private:
   using node_iterator = typename node_trait::node_iterator;
   using stack_ele = pair<pointer, node_iterator>;
 
-  Stack<stack_ele> node_stack_;
+  Stack<stack_ele, Allocator, SmallVector<stack_ele, 16>> node_stack_;
   /// mapnodeslotΪtrue˵Ѿɣfalse˵ڱ
   /// û˵Ӧslot˵û
   map<pointer, bool> visited_;
@@ -140,7 +141,7 @@ class DirectGraphPostOrderIterator {
   using node_iterator = typename node_trait::node_iterator;
   using stack_ele = pair<pointer, node_iterator>;
 
-  Stack<stack_ele> node_stack_;
+  Stack<stack_ele, Allocator, SmallVector<stack_ele, 16>> node_stack_;
   /// mapnodeslotΪtrue˵Ѿɣfalse˵ڱ
   /// û˵Ӧslot˵û
   map<pointer, bool> visited_;
@@ -0,0 +1,281 @@
+/**
+ * IntrusiveList: ʽ˫
+ * ָ뱣ûIntrusiveListHookԱУκڴ棬
+ * Ҳӵж󣬶û
+ * һзŶӾͿͬʱڶ(LRUҳ)
+ * ֪ʱO(1)شƳҪȲҵ
+ * ListList.hеListLinkBefore/ListUnlink/ListTransfer
+ * Թʱܱٻƶ
+ * ڶеƫΪģ͹֮תǳƫϵ
+ * ָ㣬IntrusiveList<Page, offsetof(Page, Lru)>
+ * 
+ *	push_back/push_front		Ѷҵβ/ͷ
+ *	pop_back/pop_front			ժβ/ͷ
+ *	insert						ѶҵWhere֮Listһ
+ *	remove						ժָ
+ *	splice						ĶƵWhere֮ǰ
+ *	iterator_to					ָĵ
+ **/
+#pragma once
+
+#include "List.h"
+#include <assert.h>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace adt {
+
+/// @brief:Ƕ뵽ûеӣʱNextΪ
+struct IntrusiveListHook {
+  IntrusiveListHook *Prev = nullptr;
+  IntrusiveListHook *Next = nullptr;
+
+  IntrusiveListHook() = default;
+
+  /// ƶʱϵ
+  IntrusiveListHook(const IntrusiveListHook &) {}
+  IntrusiveListHook &operator=(const IntrusiveListHook &) { return *this; }
+
+  bool is_linked() const { return Next != nullptr; }
+};
+
+/// @brief:Ӻڶ֮תOffsetΪӳԱTyеƫ
+template <typename Ty, size_t Offset> struct IntrusiveListTraits {
+  static Ty *FromHook(const IntrusiveListHook *Link) {
+    static_assert(Offset + sizeof(IntrusiveListHook) <= sizeof(Ty),
+                  "hook offset is out of range");
+    return (Ty *)((const char *)Link - Offset);
+  }
+
+  static IntrusiveListHook *ToHook(Ty &Object) {
+    return (IntrusiveListHook *)((char *)&Object + Offset);
+  }
+};
+
+template <typename Ty, size_t Offset, bool IsConst>
+class IntrusiveListIterator {
+public:
+  using traits = IntrusiveListTraits<Ty, Offset>;
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = Ty;
+  using pointer = std::conditional_t<IsConst, const Ty *, Ty *>;
+  using reference = std::conditional_t<IsConst, const Ty &, Ty &>;
+  using difference_type = ptrdiff_t;
+
+public:
+  IntrusiveListIterator() : link_(nullptr) {}
+
+  explicit IntrusiveListIterator(IntrusiveListHook *Link) : link_(Link) {}
+
+  /// @brief:ǳתΪ
+  template <bool OtherConst,
+            typename = std::enable_if_t<IsConst && !OtherConst>>
+  IntrusiveListIterator(
+      const IntrusiveListIterator<Ty, Offset, OtherConst> &Another)
+      : link_(Another.data()) {}
+
+  IntrusiveListIterator &operator++() {
+    link_ = link_->Next;
+    return *this;
+  }
+
+  IntrusiveListIterator &operator--() {
+    link_ = link_->Prev;
+    return *this;
+  }
+
+  const IntrusiveListIterator operator++(int) {
+    IntrusiveListIterator it = *this;
+    ++*this;
+    return it;
+  }
+
+  const IntrusiveListIterator operator--(int) {
+    IntrusiveListIterator it = *this;
+    --*this;
+    return it;
+  }
+
+  reference operator*() const { return *traits::FromHook(link_); }
+
+  pointer operator->() const { return traits::FromHook(link_); }
+
+  bool operator==(const IntrusiveListIterator &Another) const {
+    return link_ == Another.link_;
+  }
+
+  bool operator!=(const IntrusiveListIterator &Another) const {
+    return link_ != Another.link_;
+  }
+
+  IntrusiveListHook *data() const { return link_; }
+
+private:
+  IntrusiveListHook *link_;
+};
+
+template <typename Ty, size_t Offset> class IntrusiveList {
+public:
+  using traits = IntrusiveListTraits<Ty, Offset>;
+  using reference = Ty &;
+  using const_reference = const Ty &;
+  using value_type = Ty;
+  using iterator = IntrusiveListIterator<Ty, Offset, false>;
+  using const_iterator = IntrusiveListIterator<Ty, Offset, true>;
+
+public:
+  IntrusiveList() { head_.Next = head_.Prev = &head_; }
+
+  IntrusiveList(const IntrusiveList &) = delete;
+  IntrusiveList &operator=(const IntrusiveList &) = delete;
+
+  IntrusiveList(IntrusiveList &&Another) {
+    head_.Next = head_.Prev = &head_;
+    splice(end(), Another);
+  }
+
+  IntrusiveList &operator=(IntrusiveList &&Right) {
+    if (this == &Right)
+      return *this;
+    clear();
+    splice(end(), Right);
+    return *this;
+  }
+
+  /// @brief:ժж󣬲ٶ
+  ~IntrusiveList() { clear(); }
+
+  void push_back(reference Object) { LinkBefore(&head_, Object); }
+
+  void push_front(reference Object) { LinkBefore(head_.Next, Object); }
+
+  /// @brief:ObjectҵWhere֮WhereΪend()ʱҵͷ
+  iterator insert(iterator Where, reference Object) {
+    return LinkBefore(Where.data()->Next, Object);
+  }
+
+  /// @brief:ժObjectO(1)Objectڵǰ
+  void remove(reference Object) {
+    IntrusiveListHook *link = traits::ToHook(Object);
+    assert(link->is_linked() && Owns(link));
+    Unlink(link);
+  }
+
+  /// @brief:ժWhereĶ󣬷һ
+  iterator erase(iterator Where) {
+    IntrusiveListHook *next = Where.data()->Next;
+    Unlink(Where.data());
+    return iterator(next);
+  }
+
+  void pop_front() {
+    assert(size_ > 0);
+    Unlink(head_.Next);
+  }
+
+  void pop_back() {
+    assert(size_ > 0);
+    Unlink(head_.Prev);
+  }
+
+  reference front() {
+    assert(size_ > 0);
+    return *traits::FromHook(head_.Next);
+  }
+
+  const_reference front() const {
+    assert(size_ > 0);
+    return *traits::FromHook(head_.Next);
+  }
+
+  reference back() {
+    assert(size_ > 0);
+    return *traits::FromHook(head_.Prev);
+  }
+
+  const_reference back() const {
+    assert(size_ > 0);
+    return *traits::FromHook(head_.Prev);
+  }
+
+  iterator begin() { return iterator(head_.Next); }
+  iterator end() { return iterator(&head_); }
+  const_iterator begin() const { return const_iterator(head_.Next); }
+  const_iterator end() const { return const_iterator(GetHead()); }
+
+  /// @brief:ָObjectĵObjectڵǰ
+  iterator iterator_to(reference Object) {
+    assert(traits::ToHook(Object)->is_linked() &&
+           Owns(traits::ToHook(Object)));
+    return iterator(traits::ToHook(Object));
+  }
+
+  /// @brief:AnotherжƵWhere֮ǰList::spliceһ
+  void splice(iterator Where, IntrusiveList &Another) {
+    if (this == &Another || Another.size_ == 0)
+      return;
+    ListTransfer(Where.data(), Another.head_.Next, Another.head_.Prev);
+    size_ += Another.size_;
+    Another.size_ = 0;
+  }
+
+  /// @brief:AnotherItĶƵWhere֮ǰ
+  void splice(iterator Where, IntrusiveList &Another, iterator It) {
+    IntrusiveListHook *link = It.data();
+    if (link == Where.data() || link->Next == Where.data())
+      return;
+    ListTransfer(Where.data(), link, link);
+    ++size_;
+    --Another.size_;
+  }
+
+  /// @brief:ժж󣬲ٶ
+  void clear() {
+    IntrusiveListHook *link = head_.Next;
+    while (link != &head_) {
+      IntrusiveListHook *next = link->Next;
+      link->Prev = link->Next = nullptr;
+      link = next;
+    }
+    head_.Next = head_.Prev = &head_;
+    size_ = 0;
+  }
+
+  size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+
+private:
+  IntrusiveListHook *GetHead() const {
+    return const_cast<IntrusiveListHook *>(&head_);
+  }
+
+  /// @brief:LinkǷڵǰϣߵͷ㣬ֻڶԣO(n)
+  bool Owns(const IntrusiveListHook *Link) const {
+    const IntrusiveListHook *link = Link;
+    for (size_t i = 0; i <= size_; ++i, link = link->Next)
+      if (link == &head_)
+        return true;
+    return false;
+  }
+
+  iterator LinkBefore(IntrusiveListHook *Where, reference Object) {
+    IntrusiveListHook *link = traits::ToHook(Object);
+    assert(!link->is_linked());
+    ListLinkBefore(Where, link);
+    ++size_;
+    return iterator(link);
+  }
+
+  void Unlink(IntrusiveListHook *Link) {
+    ListUnlink(Link);
+    Link->Prev = Link->Next = nullptr;
+    --size_;
+  }
+
+private:
+  IntrusiveListHook head_;
+  size_t size_ = 0;
+};
+
+} // namespace adt
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Allocator.h"
+#include "Basis.h"
 #include <assert.h>
 #include <iostream>
 #include <memory>
@@ -8,6 +9,42 @@
 
 namespace adt {
 
+/// ˫ĽListIntrusiveList
+/// LinkTyҪָLinkTyPrevNextԱ
+
+/// @brief:NodeӵWhere֮ǰ
+template <typename LinkTy> void ListLinkBefore(LinkTy *Where, LinkTy *Node) {
+  Node->Next = Where;
+  Node->Prev = Where->Prev;
+  Where->Prev->Next = Node;
+  Where->Prev = Node;
+}
+
+/// @brief:NodeӵWhere֮
+template <typename LinkTy> void ListLinkAfter(LinkTy *Where, LinkTy *Node) {
+  Node->Next = Where->Next;
+  Node->Prev = Where;
+  Where->Next->Prev = Node;
+  Where->Next = Node;
+}
+
+/// @brief:Nodeڵժ£޸NodeԼָ
+template <typename LinkTy> void ListUnlink(LinkTy *Node) {
+  Node->Prev->Next = Node->Next;
+  Node->Next->Prev = Node->Prev;
+}
+
+/// @brief:[First,Last]Ľԭժ£ŵWhere֮ǰ
+template <typename LinkTy>
+void ListTransfer(LinkTy *Where, LinkTy *First, LinkTy *Last) {
+  First->Prev->Next = Last->Next;
+  Last->Next->Prev = First->Prev;
+  First->Prev = Where->Prev;
+  Last->Next = Where;
+  Where->Prev->Next = First;
+  Where->Prev = Last;
+}
+
 template <typename Ty> struct ListNode {
   ListNode *Prev = nullptr;
   ListNode *Next = nullptr;
@@ -20,7 +57,6 @@ template <typename Ty> struct ListNode {
   template <typename... ValTy>
   explicit ListNode(ValTy &&... V) : Value(std::forward<ValTy>(V)...) {}
 
-  ~ListNode() { Value.~Ty(); }
 };
 
 template <typename Ty> class ListConstIterator {
@@ -132,7 +168,8 @@ private:
   node_ptr node_;
 };
 
-template <typename Ty, typename AllocatorTy = Allocator> class List {
+template <typename Ty, typename AllocatorTy = Allocator>
+class List : private AllocatorHolder<AllocatorTy> {
 public:
   using node = ListNode<Ty>;
   using node_ptr = ListNode<Ty> *;
@@ -143,20 +180,26 @@ public:
   using const_iterator = ListConstIterator<Ty>;
 
   using al_ = AllocatorTy;
+  using holder_ = AllocatorHolder<AllocatorTy>;
 
 public:
   explicit List() : head_(Ty()) { head_.Next = head_.Prev = &head_; }
 
+  explicit List(const AllocatorTy &Al) : holder_(Al), head_(Ty()) {
+    head_.Next = head_.Prev = &head_;
+  }
+
   explicit List(const_reference Element) : head_(Ty()) {
     head_.Next = head_.Prev = &head_;
   }
 
-  explicit List(const List &another) {
+  explicit List(const List &another) : holder_(another.GetAllocator()) {
     head_.Next = head_.Prev = &head_;
     insert(end(), another.begin(), another.end());
   }
 
-  explicit List(List &&another) {
+  explicit List(List &&another)
+      : holder_(std::move(another.GetAllocator())) {
     if (another.size() == 0) {
       head_.Next = head_.Prev = &head_;
       return;
@@ -297,6 +340,105 @@ public:
     }
   }
 
+  /// @brief:AnotherнƵWhere֮ǰԪ
+  /// @note:std::listһ£spliceŵWhere֮ǰWhereΪend()ʱ׷ӵβ
+  /// ķҪܻͷŶԷĽ
+  void splice(iterator Where, List &Another) {
+    if (this == &Another || Another.size_ == 0)
+      return;
+    ListTransfer(Where.data(), Another.head_.Next, Another.head_.Prev);
+    size_ += Another.size_;
+    Another.size_ = 0;
+  }
+
+  /// @brief:AnotherItĽƵWhere֮ǰ
+  void splice(iterator Where, List &Another, iterator It) {
+    node_ptr node = It.data();
+    if (node == Where.data() || node->Next == Where.data())
+      return;
+    ListTransfer(Where.data(), node, node);
+    ++size_;
+    --Another.size_;
+  }
+
+  /// @brief:Another[First,Last)ĽƵWhere֮ǰ
+  /// ʱҪ֪ʱʹôCount
+  void splice(iterator Where, List &Another, iterator First, iterator Last) {
+    size_t count = 0;
+    if (this != &Another)
+      for (iterator it = First; it != Last; ++it)
+        ++count;
+    splice(Where, Another, First, Last, count);
+  }
+
+  /// @brief:Another[First,Last)CountƵWhere֮ǰO(1)
+  void splice(iterator Where, List &Another, iterator First, iterator Last,
+              size_t Count) {
+    if (First == Last)
+      return;
+    ListTransfer(Where.data(), First.data(), Last.data()->Prev);
+    if (this != &Another) {
+      size_ += Count;
+      Another.size_ -= Count;
+    }
+  }
+
+  /// @brief:AnotherϲĵǰУʱǰԪǰ
+  template <typename CompareTy = Less<Ty>>
+  void merge(List &Another, CompareTy Compare = CompareTy()) {
+    if (this == &Another)
+      return;
+    node_ptr cur = head_.Next;
+    while (Another.head_.Next != &Another.head_ && cur != &head_) {
+      node_ptr first = Another.head_.Next;
+      if (Compare(first->Value, cur->Value))
+        ListTransfer(cur, first, first);
+      else
+        cur = cur->Next;
+    }
+    if (Another.head_.Next != &Another.head_)
+      ListTransfer(&head_, Another.head_.Next, Another.head_.Prev);
+    size_ += Another.size_;
+    Another.size_ = 0;
+  }
+
+  /// @brief:Եϵȶ鲢ֻ޸Ľָ룬ƶԪ
+  template <typename CompareTy = Less<Ty>>
+  void sort(CompareTy Compare = CompareTy()) {
+    if (size_ < 2)
+      return;
+    /// Ͽnullptrβĵbins[i]泤Ϊ2^iΣ
+    /// ±ԽĶԽǰϲʱѿǰĶηǰԱȶ
+    node_ptr bins[64] = {};
+    head_.Prev->Next = nullptr;
+    node_ptr rest = head_.Next;
+    while (rest) {
+      node_ptr run = rest;
+      rest = rest->Next;
+      run->Next = nullptr;
+      size_t i = 0;
+      for (; bins[i]; ++i) {
+        run = MergeRuns(bins[i], run, Compare);
+        bins[i] = nullptr;
+      }
+      bins[i] = run;
+    }
+    node_ptr sorted = nullptr;
+    for (node_ptr bin : bins)
+      if (bin)
+        sorted = sorted ? MergeRuns(bin, sorted, Compare) : bin;
+
+    /// Prevָ벢ӻͷ
+    node_ptr prev = &head_;
+    for (node_ptr it = sorted; it; it = it->Next) {
+      prev->Next = it;
+      it->Prev = prev;
+      prev = it;
+    }
+    prev->Next = &head_;
+    head_.Prev = prev;
+  }
+
   void clear() {
     if (size() == 0)
       return;
@@ -310,6 +452,8 @@ public:
   size_t size() const { return size_; }
   bool empty() const { return size_ == 0; }
 
+  al_ get_allocator() const { return this->GetAllocator(); }
+
   void resize(size_t NewSize) {
     if (NewSize == size_)
       return;
@@ -354,7 +498,7 @@ private:
   /// @brief:һ½㣬Զɹ
   template <typename... ValTy> node_ptr NewNode(ValTy &&... Element) {
     /// ԼƵֵֵ
-    node_ptr new_node = (node_ptr)al_::Allocate(sizeof(node));
+    node_ptr new_node = (node_ptr)this->GetAllocator().Allocate(sizeof(node));
     ::new (new_node) node(std::forward<ValTy>(Element)...);
     return new_node;
   }
@@ -363,10 +507,7 @@ private:
   template <typename... ValTy>
   iterator InsertAfter(node_ptr Where, ValTy &&... Element) {
     node_ptr new_node = NewNode(std::forward<ValTy>(Element)...);
-    new_node->Next = Where->Next;
-    new_node->Prev = Where;
-    Where->Next->Prev = new_node;
-    Where->Next = new_node;
+    ListLinkAfter(Where, new_node);
     return iterator(new_node);
   }
 
@@ -374,10 +515,7 @@ private:
   template <typename... ValTy>
   iterator InsertBefore(node_ptr Where, ValTy &&... Element) {
     node_ptr new_node = NewNode(std::forward<ValTy>(Element)...);
-    new_node->Next = Where;
-    new_node->Prev = Where->Prev;
-    Where->Prev->Next = new_node;
-    Where->Prev = new_node;
+    ListLinkBefore(Where, new_node);
     return iterator(new_node);
   }
 
@@ -393,17 +531,35 @@ private:
 
   /// @brief:һԪƳ
   iterator UnlinkAndDelete(node_ptr Where) {
-    node_ptr prev = Where->Prev;
     node_ptr next = Where->Next;
-    prev->Next = next;
-    next->Prev = prev;
+    ListUnlink(Where);
 
     Where->~ListNode();
-    al_::Deallocate(Where);
+    this->GetAllocator().Deallocate(Where, sizeof(node));
 
     return iterator(next);
   }
 
+  /// @brief:ϲnullptrβʱLeftĽǰ
+  template <typename CompareTy>
+  static node_ptr MergeRuns(node_ptr Left, node_ptr Right,
+                            CompareTy &Compare) {
+    node_ptr merged = nullptr;
+    node_ptr *tail = &merged;
+    while (Left && Right) {
+      if (Compare(Right->Value, Left->Value)) {
+        *tail = Right;
+        Right = Right->Next;
+      } else {
+        *tail = Left;
+        Left = Left->Next;
+      }
+      tail = &(*tail)->Next;
+    }
+    *tail = Left ? Left : Right;
+    return merged;
+  }
+
   /// @brief:ɾβĽ
   void RemoveTail() { UnlinkAndDelete(GetHead()->Prev); }
 
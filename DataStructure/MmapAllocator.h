@@ -0,0 +1,119 @@
+/**
+ * MmapAllocator: ҳӳĴڴ
+ * СLargeSizeֱϵͳӳڴ棬Ȱҳ(2MB)ȡʹôҳ
+ * ʱTLBȱʧ
+ *	Linux		ȳMAP_HUGETLBʧܺӳͨҳ2MB룬
+ *				madvise(MADV_HUGEPAGE)ʾںʹ͸ҳ
+ *	Windows		ȳMEM_LARGE_PAGES(ҪSeLockMemoryPrivilege)ʧܺʹͨҳ
+ * ӳõڴ水ҳ룬СLargeSizeתAllocator
+ **/
+#pragma once
+
+#include "Allocator.h"
+#include <new>
+#include <stdint.h>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+namespace adt {
+
+template <size_t LargeSize = 2 * 1024 * 1024> class MmapAllocator {
+public:
+  static constexpr size_t HugePageSize = 2 * 1024 * 1024;
+
+public:
+  static char *Allocate(size_t Size) {
+    if (Size < LargeSize)
+      return Allocator::Allocate(Size);
+    return MapPages(Size);
+  }
+
+  /// @brief:䣬ӳڴ水ҳ룬AlignmentܳҳС
+  static char *Allocate(size_t Size, size_t Alignment) {
+    if (Size < LargeSize)
+      return Allocator::Allocate(Size, Alignment);
+    return MapPages(Size);
+  }
+
+  static void Deallocate(void *Buffer, size_t Size) {
+    if (Size < LargeSize)
+      Allocator::Deallocate(Buffer, Size);
+    else
+      UnmapPages(Buffer, Size);
+  }
+
+  static void Deallocate(void *Buffer, size_t Size, size_t Alignment) {
+    if (Size < LargeSize)
+      Allocator::Deallocate(Buffer, Size, Alignment);
+    else
+      UnmapPages(Buffer, Size);
+  }
+
+private:
+  static size_t RoundUp(size_t Size) {
+    return (Size + HugePageSize - 1) & ~(HugePageSize - 1);
+  }
+
+  /// @brief:ӳSizeֽڵڴ
+  static char *MapPages(size_t Size) {
+    size_t length = RoundUp(Size);
+#ifdef _WIN32
+    SIZE_T large_page = GetLargePageMinimum();
+    if (large_page && length % large_page == 0) {
+      void *ptr = VirtualAlloc(nullptr, length,
+                               MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES,
+                               PAGE_READWRITE);
+      if (ptr)
+        return (char *)ptr;
+    }
+    void *ptr =
+        VirtualAlloc(nullptr, length, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+    if (!ptr)
+      throw std::bad_alloc();
+    return (char *)ptr;
+#else
+#ifdef MAP_HUGETLB
+    void *ptr = mmap(nullptr, length, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (ptr != MAP_FAILED)
+      return (char *)ptr;
+#endif
+    /// ӳһҳٲõβõҳ͸ҳЧ
+    size_t mapped = length + HugePageSize;
+    char *raw = (char *)mmap(nullptr, mapped, PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == (char *)MAP_FAILED)
+      throw std::bad_alloc();
+    char *aligned = (char *)(((uintptr_t)raw + HugePageSize - 1) &
+                             ~(uintptr_t)(HugePageSize - 1));
+    if (aligned != raw)
+      munmap(raw, aligned - raw);
+    size_t tail = (raw + mapped) - (aligned + length);
+    if (tail)
+      munmap(aligned + length, tail);
+#ifdef MADV_HUGEPAGE
+    madvise(aligned, length, MADV_HUGEPAGE);
+#endif
+    return aligned;
+#endif
+  }
+
+  static void UnmapPages(void *Buffer, size_t Size) {
+    if (!Buffer)
+      return;
+#ifdef _WIN32
+    VirtualFree(Buffer, 0, MEM_RELEASE);
+#else
+    munmap(Buffer, RoundUp(Size));
+#endif
+  }
+};
+
+} // namespace adt
\ No newline at end of file
@@ -0,0 +1,282 @@
+/**
+ * MmapVector: ļӳĳ־û
+ * Ԫֱӱӳ䵽ڴļУļͷһ64ֽڵļͷ¼ħ
+ * ԪشСԪظ֮ŵԪء
+ * ´ļʱֻУļͷҪлԪڷʱȱҳж룬
+ * ڴ治ʱɲϵͳҳ渺𻻳ʺϴڴݼ
+ * չʱļӳ䣺
+ *	Linux		ftruncate + mremap
+ *	POSIX	ftruncate + munmap/mmap
+ *	Windows		SetEndOfFile + ´ļӳ
+ * ֻܱƽƵͣԪеָ´򿪺û塣
+ * 
+ *	flush			Ԫظдļͷͬ
+ *	shrink_to_fit	ļضϵǰԪظ
+ **/
+#pragma once
+
+#include "Vector.h"
+#include <stdexcept>
+#include <stdint.h>
+#include <type_traits>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace adt {
+
+/// @brief:MmapVectorļͷ
+struct MmapVectorHeader {
+  static constexpr uint64_t MagicNumber = 0x4345564D4D544441ULL; /// "ADTMMVEC"
+
+  uint64_t Magic;
+  uint64_t ElementSize;
+  uint64_t Count;
+  uint64_t Reserved[5];
+};
+
+template <typename Ty, typename GrowthTy = PageGrowth<>>
+class MmapVector : public VectorBase<Ty, MmapVector<Ty, GrowthTy>> {
+  friend class VectorBase<Ty, MmapVector>;
+
+  static_assert(std::is_trivially_copyable<Ty>::value,
+                "MmapVector only stores trivially copyable types");
+  static_assert(alignof(Ty) <= sizeof(MmapVectorHeader),
+                "element alignment exceeds header size");
+
+public:
+  static constexpr size_t HeaderSize = sizeof(MmapVectorHeader);
+
+public:
+  /// @brief:PathļڻΪʱµ
+  /// @note:ļͷTyƥʱ׳std::runtime_error
+  explicit MmapVector(const char *Path) {
+    size_t file_size = OpenFile(Path);
+    try {
+      Load(file_size);
+    } catch (...) {
+      /// ִУӳļͷ
+      Unmap();
+      CloseFile();
+      throw;
+    }
+  }
+
+  MmapVector(const MmapVector &) = delete;
+  MmapVector &operator=(const MmapVector &) = delete;
+
+  MmapVector(MmapVector &&Another)
+      : base_(Another.base_), length_(Another.length_) {
+#ifdef _WIN32
+    file_ = Another.file_;
+    mapping_ = Another.mapping_;
+    Another.file_ = INVALID_HANDLE_VALUE;
+    Another.mapping_ = nullptr;
+#else
+    fd_ = Another.fd_;
+    Another.fd_ = -1;
+#endif
+    this->data_ = Another.data_;
+    this->size_ = Another.size_;
+    this->capacity_ = Another.capacity_;
+    Another.base_ = nullptr;
+    Another.length_ = 0;
+    Another.data_ = nullptr;
+    Another.size_ = Another.capacity_ = 0;
+  }
+
+  ~MmapVector() {
+    if (!base_)
+      return;
+    GetHeader()->Count = this->size_;
+    Unmap();
+    CloseFile();
+  }
+
+  /// @brief:Ԫظдļͷ޸Ĺҳͬ
+  void flush() {
+    GetHeader()->Count = this->size_;
+#ifdef _WIN32
+    FlushViewOfFile(base_, 0);
+    FlushFileBuffers(file_);
+#else
+    msync(base_, length_, MS_SYNC);
+#endif
+  }
+
+  /// @brief:ļضϵǰԪظ
+  void shrink_to_fit() {
+    if (this->size_ != this->capacity_)
+      Remap(this->size_);
+  }
+
+private:
+  MmapVectorHeader *GetHeader() const { return (MmapVectorHeader *)base_; }
+
+  /// @brief:ӳѴ򿪵ļļдµļͷУļͷ
+  void Load(size_t FileSize) {
+    if (FileSize == 0) {
+      Map(HeaderSize);
+      MmapVectorHeader *header = GetHeader();
+      header->Magic = MmapVectorHeader::MagicNumber;
+      header->ElementSize = sizeof(Ty);
+      header->Count = 0;
+      return;
+    }
+    if (FileSize < HeaderSize)
+      throw std::runtime_error("MmapVector: file is too small");
+
+    Map(FileSize);
+    MmapVectorHeader *header = GetHeader();
+    size_t capacity = (FileSize - HeaderSize) / sizeof(Ty);
+    if (header->Magic != MmapVectorHeader::MagicNumber ||
+        header->ElementSize != sizeof(Ty) || header->Count > capacity)
+      throw std::runtime_error("MmapVector: header mismatch");
+    this->size_ = header->Count;
+    this->capacity_ = capacity;
+  }
+
+  /// @brief:չļ֤СSize
+  void grow(size_t Size) {
+    if (this->capacity_ >= Size)
+      return;
+    Remap(GrowthTy::NewCapacity(this->capacity_, Size, sizeof(Ty)));
+  }
+
+  /// @brief:ļΪCapacityԪزӳ
+  void Remap(size_t Capacity) {
+    size_t length = HeaderSize + Capacity * sizeof(Ty);
+    GetHeader()->Count = this->size_;
+#ifdef _WIN32
+    Unmap();
+    LARGE_INTEGER pos;
+    pos.QuadPart = (LONGLONG)length;
+    if (!SetFilePointerEx(file_, pos, nullptr, FILE_BEGIN) ||
+        !SetEndOfFile(file_))
+      throw std::runtime_error("MmapVector: failed to resize file");
+    Map(length);
+#else
+    /// չʱļʱСӳ䣬ӳʼղļĩβ
+    size_t old_length = length_;
+    if (length > old_length && ftruncate(fd_, (off_t)length) != 0)
+      throw std::runtime_error("MmapVector: failed to resize file");
+#if defined(__linux__) && defined(MREMAP_MAYMOVE)
+    void *ptr = mremap(base_, length_, length, MREMAP_MAYMOVE);
+    if (ptr == MAP_FAILED)
+      throw std::runtime_error("MmapVector: failed to remap file");
+    base_ = (char *)ptr;
+    length_ = length;
+    this->data_ = (Ty *)(base_ + HeaderSize);
+#else
+    Unmap();
+    Map(length);
+#endif
+    if (length < old_length && ftruncate(fd_, (off_t)length) != 0)
+      throw std::runtime_error("MmapVector: failed to resize file");
+#endif
+    this->capacity_ = Capacity;
+  }
+
+  /// @brief:򿪻򴴽ļļС
+  size_t OpenFile(const char *Path) {
+#ifdef _WIN32
+    file_ = CreateFileA(Path, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ,
+                        nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file_ == INVALID_HANDLE_VALUE)
+      throw std::runtime_error("MmapVector: failed to open file");
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file_, &size)) {
+      CloseFile();
+      throw std::runtime_error("MmapVector: failed to stat file");
+    }
+    return (size_t)size.QuadPart;
+#else
+    fd_ = open(Path, O_RDWR | O_CREAT, 0644);
+    if (fd_ < 0)
+      throw std::runtime_error("MmapVector: failed to open file");
+    struct stat st;
+    if (fstat(fd_, &st) != 0) {
+      CloseFile();
+      throw std::runtime_error("MmapVector: failed to stat file");
+    }
+    return (size_t)st.st_size;
+#endif
+  }
+
+  /// @brief:ļǰLengthֽӳ䵽ڴ棬ļLengthʱļ
+  void Map(size_t Length) {
+#ifdef _WIN32
+    uint64_t length = Length;
+    mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READWRITE,
+                                  (DWORD)(length >> 32), (DWORD)length,
+                                  nullptr);
+    if (!mapping_)
+      throw std::runtime_error("MmapVector: failed to map file");
+    base_ = (char *)MapViewOfFile(mapping_, FILE_MAP_ALL_ACCESS, 0, 0, Length);
+    if (!base_) {
+      CloseHandle(mapping_);
+      mapping_ = nullptr;
+      throw std::runtime_error("MmapVector: failed to map file");
+    }
+#else
+    struct stat st;
+    if (fstat(fd_, &st) != 0 ||
+        ((size_t)st.st_size < Length && ftruncate(fd_, (off_t)Length) != 0))
+      throw std::runtime_error("MmapVector: failed to resize file");
+    void *ptr =
+        mmap(nullptr, Length, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (ptr == MAP_FAILED)
+      throw std::runtime_error("MmapVector: failed to map file");
+    base_ = (char *)ptr;
+#endif
+    length_ = Length;
+    this->data_ = (Ty *)(base_ + HeaderSize);
+  }
+
+  void Unmap() {
+    if (!base_)
+      return;
+#ifdef _WIN32
+    UnmapViewOfFile(base_);
+    CloseHandle(mapping_);
+    mapping_ = nullptr;
+#else
+    munmap(base_, length_);
+#endif
+    base_ = nullptr;
+    length_ = 0;
+  }
+
+  void CloseFile() {
+#ifdef _WIN32
+    if (file_ != INVALID_HANDLE_VALUE)
+      CloseHandle(file_);
+    file_ = INVALID_HANDLE_VALUE;
+#else
+    if (fd_ >= 0)
+      close(fd_);
+    fd_ = -1;
+#endif
+  }
+
+private:
+  char *base_ = nullptr;
+  size_t length_ = 0;
+#ifdef _WIN32
+  HANDLE file_ = INVALID_HANDLE_VALUE;
+  HANDLE mapping_ = nullptr;
+#else
+  int fd_ = -1;
+#endif
+};
+
+} // namespace adt
\ No newline at end of file
@@ -0,0 +1,319 @@
+/**
+ * Parallel: ȡ̳߳غͲ㷨
+ * ThreadPoolÿ߳ԼУ̴߳Լеβȡ
+ * ԼĶΪʱ̶߳еͷȡûʱߡ
+ * 㷨ݹض԰֣һΪ뵱ǰ̵߳ĶУ
+ * ߳ȡϴֱ֣䲻GrainԪء
+ * ߳ڵȴʱҲִже˿Ƕ׵ò㷨
+ * 
+ *	parallel_for		[First,Last)еÿԪصFunc
+ *	parallel_reduce		ɵOpԼ[First,Last)
+ *	parallel_transform	Func(*it)дDestʼ
+ * GrainΪÿԪظΪ0ʱ߳Զѡ
+ **/
+#pragma once
+
+#include "Vector.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace adt {
+
+class ThreadPool {
+public:
+  using Task = std::function<void()>;
+
+public:
+  explicit ThreadPool(size_t NumThreads = std::thread::hardware_concurrency()) {
+    if (NumThreads == 0)
+      NumThreads = 1;
+    for (size_t i = 0; i < NumThreads; ++i)
+      queues_.emplace_back(new WorkQueue());
+    for (size_t i = 0; i < NumThreads; ++i)
+      workers_.emplace_back([this, i] { WorkerLoop(i); });
+  }
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  /// @brief:ִʣй߳
+  ~ThreadPool() {
+    {
+      std::lock_guard<std::mutex> guard(sleep_lock_);
+      stop_ = true;
+    }
+    sleep_cv_.notify_all();
+    for (std::thread &worker : workers_)
+      worker.join();
+  }
+
+  size_t size() const { return workers_.size(); }
+
+  /// @brief:ύ񣬹߳ύԼĶ
+  void submit(Task NewTask) {
+    WorkerSlot &slot = CurrentWorker();
+    size_t index = slot.Pool == this
+                       ? slot.Index
+                       : next_queue_.fetch_add(1, std::memory_order_relaxed) %
+                             queues_.size();
+    {
+      std::lock_guard<std::mutex> guard(queues_[index]->Lock);
+      queues_[index]->Tasks.push_back(std::move(NewTask));
+      pending_.fetch_add(1, std::memory_order_release);
+    }
+    /// ֪ͨ⹤̼߳ʼ֮ǰ֪ͨ
+    { std::lock_guard<std::mutex> guard(sleep_lock_); }
+    sleep_cv_.notify_one();
+  }
+
+  /// @brief:ڵִ߳һȴе
+  /// @return ûпִеʱfalse
+  bool run_one() {
+    WorkerSlot &slot = CurrentWorker();
+    Task task;
+    if (!TakeTask(slot.Pool == this ? slot.Index : queues_.size(), task))
+      return false;
+    task();
+    return true;
+  }
+
+  /// @brief:ڹ̳߳أ߳Ӳ߳
+  static ThreadPool &Global() {
+    static ThreadPool pool;
+    return pool;
+  }
+
+private:
+  struct WorkQueue {
+    std::mutex Lock;
+    std::deque<Task> Tasks;
+  };
+
+  /// @brief:¼ǰ߳ĸ̳߳صĵڼ߳
+  struct WorkerSlot {
+    ThreadPool *Pool = nullptr;
+    size_t Index = 0;
+  };
+
+  static WorkerSlot &CurrentWorker() {
+    thread_local WorkerSlot slot;
+    return slot;
+  }
+
+  /// @brief:ȴIndexԼĶβȡٴͷȡ
+  bool TakeTask(size_t Index, Task &Out) {
+    if (pending_.load(std::memory_order_acquire) == 0)
+      return false;
+    size_t count = queues_.size();
+    if (Index < count) {
+      WorkQueue &own = *queues_[Index];
+      std::lock_guard<std::mutex> guard(own.Lock);
+      if (!own.Tasks.empty()) {
+        Out = std::move(own.Tasks.back());
+        own.Tasks.pop_back();
+        pending_.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+      }
+    }
+    size_t start = Index < count ? Index + 1 : 0;
+    for (size_t i = 0; i < count; ++i) {
+      WorkQueue &victim = *queues_[(start + i) % count];
+      std::lock_guard<std::mutex> guard(victim.Lock);
+      if (!victim.Tasks.empty()) {
+        Out = std::move(victim.Tasks.front());
+        victim.Tasks.pop_front();
+        pending_.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void WorkerLoop(size_t Index) {
+    CurrentWorker().Pool = this;
+    CurrentWorker().Index = Index;
+    while (true) {
+      Task task;
+      if (TakeTask(Index, task)) {
+        task();
+        continue;
+      }
+      std::unique_lock<std::mutex> lock(sleep_lock_);
+      sleep_cv_.wait(lock, [this] {
+        return stop_ || pending_.load(std::memory_order_acquire) > 0;
+      });
+      if (stop_ && pending_.load(std::memory_order_acquire) == 0)
+        return;
+    }
+  }
+
+private:
+  std::vector<std::unique_ptr<WorkQueue>> queues_;
+  std::vector<std::thread> workers_;
+  std::atomic<size_t> pending_{0};
+  std::atomic<size_t> next_queue_{0};
+  std::mutex sleep_lock_;
+  std::condition_variable sleep_cv_;
+  bool stop_ = false;
+};
+
+/// @brief:һwaitȴ׳һ쳣
+class TaskGroup {
+public:
+  explicit TaskGroup(ThreadPool &Pool = ThreadPool::Global()) : pool_(Pool) {}
+
+  TaskGroup(const TaskGroup &) = delete;
+  TaskGroup &operator=(const TaskGroup &) = delete;
+
+  ~TaskGroup() { WaitAll(); }
+
+  template <typename Func> void run(Func &&Body) {
+    remaining_.fetch_add(1, std::memory_order_relaxed);
+    pool_.submit([this, Body]() {
+      try {
+        Body();
+      } catch (...) {
+        std::lock_guard<std::mutex> guard(error_lock_);
+        if (!error_)
+          error_ = std::current_exception();
+      }
+      remaining_.fetch_sub(1, std::memory_order_release);
+    });
+  }
+
+  void wait() {
+    WaitAll();
+    if (error_) {
+      std::exception_ptr error = error_;
+      error_ = nullptr;
+      std::rethrow_exception(error);
+    }
+  }
+
+  ThreadPool &pool() const { return pool_; }
+
+private:
+  /// @brief:ȴڼִ̳߳е
+  void WaitAll() {
+    while (remaining_.load(std::memory_order_acquire) != 0) {
+      if (!pool_.run_one())
+        std::this_thread::yield();
+    }
+  }
+
+private:
+  ThreadPool &pool_;
+  std::atomic<size_t> remaining_{0};
+  std::mutex error_lock_;
+  std::exception_ptr error_;
+};
+
+/// @brief:Ĭȣÿ̴߳Լֵ8
+inline size_t DefaultGrain(const ThreadPool &Pool, size_t Count) {
+  size_t grain = Count / (8 * (Pool.size() + 1));
+  return grain ? grain : 1;
+}
+
+/// @brief:[Begin,End)԰֣һΪύֱGrain
+template <typename Func>
+void SplitRange(TaskGroup &Group, size_t Begin, size_t End, size_t Grain,
+                const Func &Body) {
+  while (End - Begin > Grain) {
+    size_t mid = Begin + (End - Begin) / 2;
+    size_t end = End;
+    Group.run([&Group, mid, end, Grain, &Body] {
+      SplitRange(Group, mid, end, Grain, Body);
+    });
+    End = mid;
+  }
+  Body(Begin, End);
+}
+
+/// @brief:[0,Count)ÿ[Begin,End)еBody(Begin, End)
+template <typename Func>
+void ParallelRange(size_t Count, size_t Grain, const Func &Body,
+                   ThreadPool &Pool = ThreadPool::Global()) {
+  if (Count == 0)
+    return;
+  if (Grain == 0)
+    Grain = DefaultGrain(Pool, Count);
+  if (Count <= Grain || Pool.size() <= 1) {
+    Body(0, Count);
+    return;
+  }
+  TaskGroup group(Pool);
+  SplitRange(group, 0, Count, Grain, Body);
+  group.wait();
+}
+
+/// @brief:[First,Last)еÿԪصFunc
+template <typename Iterator, typename Func>
+void parallel_for(Iterator First, Iterator Last, Func Body, size_t Grain = 0,
+                  ThreadPool &Pool = ThreadPool::Global()) {
+  ParallelRange(
+      Last - First, Grain,
+      [First, &Body](size_t Begin, size_t End) {
+        for (Iterator it = First + Begin, last = First + End; it != last; ++it)
+          Body(*it);
+      },
+      Pool);
+}
+
+/// @brief:OpԼ[First,Last)OpҪ
+/// ֱԼԼ䣬˳ϲInit
+template <typename Iterator, typename Ty, typename BinaryOp>
+Ty parallel_reduce(Iterator First, Iterator Last, Ty Init, BinaryOp Op,
+                   size_t Grain = 0, ThreadPool &Pool = ThreadPool::Global()) {
+  size_t count = Last - First;
+  if (count == 0)
+    return Init;
+  if (Grain == 0)
+    Grain = DefaultGrain(Pool, count);
+  size_t chunks = (count + Grain - 1) / Grain;
+  Vector<Ty> partial(chunks, Init);
+  ParallelRange(
+      chunks, 1,
+      [First, count, Grain, &Op, &partial](size_t Begin, size_t End) {
+        for (size_t c = Begin; c < End; ++c) {
+          Iterator it = First + c * Grain;
+          Iterator last = First + std::min(count, (c + 1) * Grain);
+          Ty acc = *it;
+          for (++it; it != last; ++it)
+            acc = Op(acc, *it);
+          partial[c] = std::move(acc);
+        }
+      },
+      Pool);
+  for (size_t c = 0; c < chunks; ++c)
+    Init = Op(Init, partial[c]);
+  return Init;
+}
+
+/// @brief:Func(*it)дDestʼ䣬дβ
+template <typename InIterator, typename OutIterator, typename Func>
+OutIterator parallel_transform(InIterator First, InIterator Last,
+                               OutIterator Dest, Func Body, size_t Grain = 0,
+                               ThreadPool &Pool = ThreadPool::Global()) {
+  size_t count = Last - First;
+  ParallelRange(
+      count, Grain,
+      [First, Dest, &Body](size_t Begin, size_t End) {
+        OutIterator out = Dest + Begin;
+        for (InIterator it = First + Begin, last = First + End; it != last;
+             ++it, ++out)
+          *out = Body(*it);
+      },
+      Pool);
+  return Dest + count;
+}
+
+} // namespace adt
\ No newline at end of file
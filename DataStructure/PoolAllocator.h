@@ -0,0 +1,151 @@
+/**
+ * Pool: ߴּslabڴ
+ * Сڴ水Granularityȡɳߴȼÿȼάһʽ
+ * ͷŵڴһؿ´η临ãΪʱslab˳з֡
+ * MaxSmallSizeֱתAllocator
+ * ͨResourceAllocator(&pool)Ϊ״̬
+ * 
+ *	Allocate		Sizeֽ
+ *	Deallocate		Sizeֽڵڴ黹ӦȼĿ
+ *	Release			ͷslab
+ **/
+#pragma once
+
+#include "Allocator.h"
+#include <assert.h>
+#include <cstddef>
+
+namespace adt {
+
+class Pool : public MemoryResource {
+public:
+  static constexpr size_t Granularity = 16;
+  static constexpr size_t MaxSmallSize = 512;
+  static constexpr size_t NumClasses = MaxSmallSize / Granularity;
+
+public:
+  explicit Pool(size_t SlabSize = 64 * 1024) : slab_size_(SlabSize) {
+    assert(SlabSize >= MaxSmallSize);
+  }
+
+  Pool(const Pool &) = delete;
+  Pool &operator=(const Pool &) = delete;
+
+  ~Pool() { Release(); }
+
+  /// @brief:Sizeֽ
+  char *Allocate(size_t Size) {
+    if (Size > MaxSmallSize)
+      return Allocator::Allocate(Size);
+    SizeClass &cls = classes_[ClassIndex(Size)];
+    if (cls.FreeList) {
+      FreeBlock *block = cls.FreeList;
+      cls.FreeList = block->Next;
+      return (char *)block;
+    }
+    size_t block_size = ClassSize(ClassIndex(Size));
+    if ((size_t)(cls.End - cls.Cur) < block_size) {
+      cls.Cur = NewSlab();
+      cls.End = cls.Cur + (slab_size_ - slab_size_ % block_size);
+    }
+    char *ptr = cls.Cur;
+    cls.Cur += block_size;
+    return ptr;
+  }
+
+  /// @brief:黹Sizeֽڵڴ飬Sizeʱһ
+  void Deallocate(void *Buffer, size_t Size) {
+    if (!Buffer)
+      return;
+    if (Size > MaxSmallSize) {
+      Allocator::Deallocate(Buffer, Size);
+      return;
+    }
+    SizeClass &cls = classes_[ClassIndex(Size)];
+    FreeBlock *block = (FreeBlock *)Buffer;
+    block->Next = cls.FreeList;
+    cls.FreeList = block;
+  }
+
+  /// @brief:ͷslab֮ǰСڴȫʧЧ
+  void Release() {
+    Slab *slab = slabs_;
+    while (slab) {
+      Slab *next = slab->Next;
+      Allocator::Deallocate(slab, SlabHeader() + slab_size_);
+      slab = next;
+    }
+    slabs_ = nullptr;
+    for (size_t i = 0; i < NumClasses; ++i)
+      classes_[i] = SizeClass();
+  }
+
+  /// @brief:ȡSizeĳߴȼ
+  static size_t ClassIndex(size_t Size) {
+    return Size == 0 ? 0 : (Size - 1) / Granularity;
+  }
+
+  /// @brief:ȡߴȼӦڴС
+  static size_t ClassSize(size_t Index) { return (Index + 1) * Granularity; }
+
+protected:
+  char *DoAllocate(size_t Size) override { return Allocate(Size); }
+
+  void DoDeallocate(void *Buffer, size_t Size) override {
+    Deallocate(Buffer, Size);
+  }
+
+private:
+  struct FreeBlock {
+    FreeBlock *Next;
+  };
+
+  struct Slab {
+    Slab *Next;
+  };
+
+  struct SizeClass {
+    FreeBlock *FreeList = nullptr;
+    char *Cur = nullptr;
+    char *End = nullptr;
+  };
+
+  static size_t SlabHeader() {
+    return (sizeof(Slab) + Granularity - 1) & ~(Granularity - 1);
+  }
+
+  /// @brief:һµslabؿзʼַ
+  char *NewSlab() {
+    Slab *slab = (Slab *)Allocator::Allocate(SlabHeader() + slab_size_);
+    slab->Next = slabs_;
+    slabs_ = slab;
+    return (char *)slab + SlabHeader();
+  }
+
+private:
+  size_t slab_size_;
+  Slab *slabs_ = nullptr;
+  SizeClass classes_[NumClasses];
+};
+
+/// @brief:PoolķԣΪAllocatorTy
+/// @note:ͬһTagһPool̰߳ȫ
+template <typename Tag = void, size_t SlabSize = 64 * 1024>
+class PoolAllocator {
+public:
+  static char *Allocate(size_t Size) { return GetPool().Allocate(Size); }
+
+  static void Deallocate(void *Buffer, size_t Size) {
+    GetPool().Deallocate(Buffer, Size);
+  }
+
+  /// @brief:ͷŸTagµslabúЩʹ
+  static void Release() { GetPool().Release(); }
+
+  static Pool &GetPool() {
+    static Pool pool(SlabSize);
+    return pool;
+  }
+};
+
+} // namespace adt
\ No newline at end of file
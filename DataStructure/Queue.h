@@ -1,12 +1,37 @@
+/**
+ * Queue: 
+ * ײĬΪDequeԪرڻλУ͵Ҫڴ棬
+ * ײҪṩemplace_backpop_frontfrontback
+ * ҲʹListSegmentedVector
+ * PriorityQueue: VectorArityѣĬΪ4
+ * Ѷ֮ǰArity-1ԪأÿArityӽʼ±궼Arityı
+ * VectorĴ󻺳ж룬Arity*sizeof(Ty)ʱ
+ * һӽͬһУ
+ * ³ÿһֻһλȱʧҲֻжѵ1/log2(Arity)
+ * IndexedPriorityQueue: Ķѣ֧ͨ޸ĺɾԪ
+ * RadixHeap: ѣΪС
+ **/
 #pragma once
 
 #include "Basis.h"
+#include "Deque.h"
 #include "List.h"
+#include "SmallVector.h"
 #include "Vector.h"
+#include <stdint.h>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
 
 namespace adt {
 
-template <typename Ty, typename AllocatorTy = Allocator> class Queue {
+template <typename Ty, typename AllocatorTy = Allocator,
+          typename ContainerTy = Deque<Ty, AllocatorTy>>
+class Queue {
 public:
   using reference = Ty &;
   using const_reference = const Ty &;
@@ -14,19 +39,24 @@ public:
   using const_pointer = const Ty *;
 
   using al_ = AllocatorTy;
+  using container_type = ContainerTy;
 
 public:
   Queue() {}
 
-  Queue(const Queue &Another) {
-    using Iterator = typename List<Ty, al_>::iterator;
+  explicit Queue(const AllocatorTy &Al) : container_(Al) {}
+
+  Queue(const Queue &Another) : container_(Another.get_allocator()) {
+    using Iterator = typename ContainerTy::const_iterator;
+    if (Another.empty())
+      return;
     for (Iterator it = Another.container_.begin();
          it != Another.container_.end(); ++it) {
       push(*it);
     }
   }
 
-  Queue(Queue &&Another) { container_ = std::move(Another.container_); }
+  Queue(Queue &&Another) : container_(std::move(Another.container_)) {}
 
   Queue(std::initializer_list<Ty> list) {
     for (auto it = list.begin(); it != list.end(); ++it)
@@ -40,7 +70,7 @@ public:
   }
 
   void push(const Ty &Element) { container_.emplace_back(Element); }
-  void push(Ty &&Element) { container_.emplace_back(Element); }
+  void push(Ty &&Element) { container_.emplace_back(std::move(Element)); }
   void pop() { container_.pop_front(); }
 
   template <typename... ValTy> void emplace(ValTy... Value) {
@@ -55,129 +85,208 @@ public:
   size_t size() const { return container_.size(); }
   bool empty() const { return container_.empty(); }
 
+  al_ get_allocator() const { return container_.get_allocator(); }
+
 private:
-  List<Ty, al_> container_;
+  ContainerTy container_;
 };
 
-template <typename Ty, typename AllocatorTy = Allocator> class PriorityQueue {
+template <typename Ty, typename AllocatorTy = Allocator, size_t Arity = 4,
+          typename CompareTy = Less<Ty>>
+class PriorityQueue {
+  static_assert(Arity >= 2, "heap arity must be at least 2");
+
 public:
   using reference = Ty &;
   using const_reference = const Ty &;
   using pointer = Ty *;
   using const_pointer = const Ty *;
-  using value_compare = Less<Ty>;
+  using value_compare = CompareTy;
 
   using al_ = AllocatorTy;
 
-  PriorityQueue() : less_(value_compare()) { container_.resize(1); }
+  /// Ѷ֮ǰԪظʹÿӽʼ±궼Arityı
+  static constexpr size_t Offset = Arity - 1;
+
+  PriorityQueue() : less_(value_compare()) { container_.resize(Offset); }
 
   PriorityQueue(const value_compare &Pred) : less_(Pred) {
-    container_.resize(1);
+    container_.resize(Offset);
   }
 
+  explicit PriorityQueue(const AllocatorTy &Al,
+                         const value_compare &Pred = value_compare())
+      : container_(Al), less_(Pred) {
+    container_.resize(Offset);
+  }
+
+  /// @brief:[First,Last)ԪԵϽѣO(n)
   template <typename Iterator>
   PriorityQueue(Iterator First, Iterator Last) : less_(value_compare()) {
-    container_.resize(1);
-    for (Iterator it = First; it < Last; ++it)
-      push(*it);
+    container_.resize(Offset);
+    container_.append(First, Last);
+    Heapify();
   }
 
   template <typename Iterator>
   PriorityQueue(Iterator First, Iterator Last, const value_compare &Pred)
       : less_(Pred) {
-    container_.resize(1);
-    for (Iterator it = First; it < Last; ++it)
-      push(*it);
+    container_.resize(Offset);
+    container_.append(First, Last);
+    Heapify();
   }
 
-  PriorityQueue(const PriorityQueue &Another) {
-    using Iterator = typename Vector<Ty, al_>::iterator;
-    container_.resize(1);
-    for (Iterator it = ++Another.container_.begin();
-         it < Another.container_.end(); ++it)
-      push(*it);
-  }
+  /// @brief:ֱӸƵײVectorҪ½
+  PriorityQueue(const PriorityQueue &Another)
+      : container_(Another.container_), less_(Another.less_) {}
 
-  PriorityQueue(PriorityQueue &&Another) {
-    container_ = std::move(Another.container_);
-    less_ = Another.less_;
+  PriorityQueue(PriorityQueue &&Another)
+      : container_(std::move(Another.container_)), less_(Another.less_) {
+    Another.container_.resize(Offset);
   }
 
   PriorityQueue(std::initializer_list<Ty> list, const value_compare &Pred)
       : less_(Pred) {
-    for (auto it = list.begin(); it != list.end(); ++it)
-      emplace(*it);
+    container_.resize(Offset);
+    container_.append(list.begin(), list.end());
+    Heapify();
   }
 
   PriorityQueue(std::initializer_list<Ty> list) : less_(value_compare()) {
-    for (auto it = list.begin(); it != list.end(); ++it)
-      emplace(*it);
+    container_.resize(Offset);
+    container_.append(list.begin(), list.end());
+    Heapify();
+  }
+
+  PriorityQueue &operator=(const PriorityQueue &Right) {
+    if (this == &Right)
+      return *this;
+    container_.assign(Right.container_.begin(), Right.container_.end());
+    less_ = Right.less_;
+    return *this;
+  }
+
+  PriorityQueue &operator=(PriorityQueue &&Right) {
+    if (this == &Right)
+      return *this;
+    container_ = std::move(Right.container_);
+    less_ = Right.less_;
+    Right.container_.resize(Offset);
+    return *this;
   }
 
   void push(const Ty &Element) {
     container_.emplace_back(Element);
-    AdjustLast();
+    SiftUp(size() - 1);
   }
 
   void push(Ty &&Element) {
-    container_.emplace_back(Element);
-    AdjustLast();
+    container_.emplace_back(std::move(Element));
+    SiftUp(size() - 1);
   }
 
-  template <typename... ValTy> void emplace(ValTy... Element) {
+  template <typename... ValTy> void emplace(ValTy &&... Element) {
     container_.emplace_back(std::forward<ValTy>(Element)...);
-    AdjustLast();
+    SiftUp(size() - 1);
+  }
+
+  /// @brief:[First,Last)Ԫ
+  /// ϸĴԼΪԶѵĲԪʱΪؽ
+  template <typename Iterator> void push_range(Iterator First, Iterator Last) {
+    size_t old_size = size();
+    container_.append(First, Last);
+    size_t added = size() - old_size;
+    size_t depth = 0;
+    for (size_t n = size(); n > 1; n /= Arity)
+      ++depth;
+    if (added * depth > size()) {
+      Heapify();
+      return;
+    }
+    for (size_t i = old_size; i < size(); ++i)
+      SiftUp(i);
   }
 
   void pop() {
     assert(!empty());
-    size_t LastIdx = container_.size() - 1;
-    container_[1] = std::move(container_[LastIdx]);
+    size_t last = size() - 1;
+    if (last != 0)
+      At(0) = std::move(At(last));
     container_.pop_back();
-    AdjustFirst();
+    if (last > 1)
+      SiftDown(0);
+  }
+
+  /// @brief:ѶѶƶOutٵҪȸtop()
+  void pop(Ty &Out) {
+    assert(!empty());
+    Out = std::move(At(0));
+    pop();
   }
 
   const Ty &top() const {
     assert(!empty());
-    return container_[1];
+    return At(0);
   }
 
-  size_t size() const { return container_.size(); }
+  /// @brief:ԪظԪ
+  size_t size() const { return container_.size() - Offset; }
 
   bool empty() const { return !size(); }
 
+  al_ get_allocator() const { return container_.get_allocator(); }
+
 private:
-  /// @brief һԪϸ
-  void AdjustLast() {
-    size_t LastIdx = container_.size() - 1, Parent = LastIdx / 2;
-    while (Parent >= 1) {
-      Ty &Last = container_[LastIdx];
-      if (less_.operator()(container_[Parent], Last)) {
-        Swap(Last, container_[Parent]);
-        LastIdx = Parent;
-        Parent /= 2;
-      } else
+  /// @brief:еIdxԪأӽΪIdx*Arity+1Idx*Arity+Arity
+  Ty &At(size_t Idx) { return container_[Idx + Offset]; }
+  const Ty &At(size_t Idx) const { return container_[Idx + Offset]; }
+
+  /// @brief:FloydѣһҶ㿪ʼ³
+  void Heapify() {
+    if (size() < 2)
+      return;
+    for (size_t i = (size() - 2) / Arity + 1; i-- > 0;)
+      SiftDown(i);
+  }
+
+  /// @brief:HoleԪϸ;Ѹƣֻдһ
+  void SiftUp(size_t Hole) {
+    if (Hole == 0)
+      return;
+    Ty value = std::move(At(Hole));
+    while (Hole > 0) {
+      size_t parent = (Hole - 1) / Arity;
+      if (!less_(At(parent), value))
         break;
+      At(Hole) = std::move(At(parent));
+      Hole = parent;
     }
+    At(Hole) = std::move(value);
   }
 
-  /// @brief һԪ³
-  void AdjustFirst() {
-    size_t LeftChild = 2;
-    size_t MaxIdx = LeftChild;
-    size_t RightChild = LeftChild + 1;
-    while (LeftChild < container_.size()) {
-      if (RightChild < container_.size() &&
-          less_.operator()(container_[LeftChild], container_[RightChild])) {
-        MaxIdx = RightChild;
-      }
-      if (less_.operator()(container_[LeftChild / 2], container_[MaxIdx])) {
-        Swap(container_[MaxIdx], container_[LeftChild / 2]);
-        LeftChild = MaxIdx;
-        continue;
+  /// @brief:HoleԪ³;ӽƣֻдһ
+  /// ӽʹù̶ѭѡֵչ
+  void SiftDown(size_t Hole) {
+    size_t count = size();
+    Ty value = std::move(At(Hole));
+    while (true) {
+      size_t first = Hole * Arity + 1;
+      if (first >= count)
+        break;
+      size_t best = first;
+      if (first + Arity <= count) {
+        for (size_t i = 1; i < Arity; ++i)
+          best = less_(At(best), At(first + i)) ? first + i : best;
+      } else {
+        for (size_t child = first + 1; child < count; ++child)
+          best = less_(At(best), At(child)) ? child : best;
       }
-      break;
+      if (!less_(value, At(best)))
+        break;
+      At(Hole) = std::move(At(best));
+      Hole = best;
     }
+    At(Hole) = std::move(value);
   }
 
 private:
@@ -185,4 +294,370 @@ private:
   value_compare less_;
 };
 
+/// @brief:Arityѣpushؾͨ޸ĻɾԪ
+/// бԪغ;positions_¼ÿڶеλã
+/// Ƚʱֻʶ鱾޸λʱ˳positions_
+/// Ԫرɾ֮ǰֲ䣬֮ᱻʹá
+/// promote/demote޸ĺЧȽķ޹أ
+/// promoteʹԪظѶ(DijkstraСмС)demote෴
+template <typename Ty, typename AllocatorTy = Allocator, size_t Arity = 4,
+          typename CompareTy = Less<Ty>>
+class IndexedPriorityQueue {
+  static_assert(Arity >= 2, "heap arity must be at least 2");
+
+public:
+  using reference = Ty &;
+  using const_reference = const Ty &;
+  using value_compare = CompareTy;
+  using handle_type = size_t;
+
+  using al_ = AllocatorTy;
+
+  static constexpr handle_type npos = (handle_type)-1;
+
+public:
+  IndexedPriorityQueue() : less_(value_compare()) {}
+
+  explicit IndexedPriorityQueue(const value_compare &Pred) : less_(Pred) {}
+
+  explicit IndexedPriorityQueue(const AllocatorTy &Al,
+                                const value_compare &Pred = value_compare())
+      : heap_(Al), positions_(Al), free_(Al), less_(Pred) {}
+
+  handle_type push(const Ty &Element) { return emplace(Element); }
+  handle_type push(Ty &&Element) { return emplace(std::move(Element)); }
+
+  template <typename... ValTy> handle_type emplace(ValTy &&... Element) {
+    handle_type handle;
+    if (free_.size() == 0) {
+      handle = positions_.size();
+      positions_.push_back(heap_.size());
+    } else {
+      handle = free_.back();
+      free_.pop_back();
+      positions_[handle] = heap_.size();
+    }
+    heap_.emplace_back(handle, std::forward<ValTy>(Element)...);
+    SiftUp(heap_.size() - 1);
+    return handle;
+  }
+
+  void pop() {
+    assert(!empty());
+    RemoveAt(0);
+  }
+
+  const Ty &top() const {
+    assert(!empty());
+    return heap_[0].Value;
+  }
+
+  handle_type top_handle() const {
+    assert(!empty());
+    return heap_[0].Handle;
+  }
+
+  /// @brief:HandleӦԪǷڶ
+  bool contains(handle_type Handle) const {
+    return Handle < positions_.size() && positions_[Handle] != npos;
+  }
+
+  const Ty &get(handle_type Handle) const {
+    assert(contains(Handle));
+    return heap_[positions_[Handle]].Value;
+  }
+
+  /// @brief:ɾHandleӦԪ
+  void erase(handle_type Handle) {
+    assert(contains(Handle));
+    RemoveAt(positions_[Handle]);
+  }
+
+  /// @brief:޸HandleӦԪأValueܱԭԪظѵ
+  void promote(handle_type Handle, const Ty &Value) {
+    assert(contains(Handle));
+    size_t pos = positions_[Handle];
+    assert(!less_(Value, heap_[pos].Value));
+    heap_[pos].Value = Value;
+    SiftUp(pos);
+  }
+
+  /// @brief:޸HandleӦԪأValueܱԭԪظѶ
+  void demote(handle_type Handle, const Ty &Value) {
+    assert(contains(Handle));
+    size_t pos = positions_[Handle];
+    assert(!less_(heap_[pos].Value, Value));
+    heap_[pos].Value = Value;
+    SiftDown(pos);
+  }
+
+  /// @brief:޸HandleӦԪأֵԶϸ³
+  void update(handle_type Handle, const Ty &Value) {
+    assert(contains(Handle));
+    size_t pos = positions_[Handle];
+    bool up = less_(heap_[pos].Value, Value);
+    heap_[pos].Value = Value;
+    if (up)
+      SiftUp(pos);
+    else
+      SiftDown(pos);
+  }
+
+  void clear() {
+    heap_.clear();
+    positions_.clear();
+    free_.clear();
+  }
+
+  size_t size() const { return heap_.size(); }
+
+  bool empty() const { return heap_.size() == 0; }
+
+  al_ get_allocator() const { return heap_.get_allocator(); }
+
+private:
+  struct Entry {
+    handle_type Handle;
+    Ty Value;
+
+    template <typename... ValTy>
+    explicit Entry(handle_type H, ValTy &&... V)
+        : Handle(H), Value(std::forward<ValTy>(V)...) {}
+  };
+
+  /// @brief:ɾPosԪأһԪµ
+  void RemoveAt(size_t Pos) {
+    handle_type handle = heap_[Pos].Handle;
+    positions_[handle] = npos;
+    free_.push_back(handle);
+    size_t last = heap_.size() - 1;
+    if (Pos != last) {
+      heap_[Pos] = std::move(heap_[last]);
+      positions_[heap_[Pos].Handle] = Pos;
+    }
+    heap_.pop_back();
+    if (Pos >= heap_.size())
+      return;
+    if (Pos > 0 && less_(heap_[(Pos - 1) / Arity].Value, heap_[Pos].Value))
+      SiftUp(Pos);
+    else
+      SiftDown(Pos);
+  }
+
+  /// @brief:EntryŵPos¼λ
+  void Place(size_t Pos, Entry &&Element) {
+    positions_[Element.Handle] = Pos;
+    heap_[Pos] = std::move(Element);
+  }
+
+  void SiftUp(size_t Hole) {
+    if (Hole == 0)
+      return;
+    Entry value = std::move(heap_[Hole]);
+    while (Hole > 0) {
+      size_t parent = (Hole - 1) / Arity;
+      if (!less_(heap_[parent].Value, value.Value))
+        break;
+      Place(Hole, std::move(heap_[parent]));
+      Hole = parent;
+    }
+    Place(Hole, std::move(value));
+  }
+
+  void SiftDown(size_t Hole) {
+    size_t count = heap_.size();
+    Entry value = std::move(heap_[Hole]);
+    while (true) {
+      size_t first = Hole * Arity + 1;
+      if (first >= count)
+        break;
+      size_t last = first + Arity < count ? first + Arity : count;
+      size_t best = first;
+      for (size_t child = first + 1; child < last; ++child)
+        best = less_(heap_[best].Value, heap_[child].Value) ? child : best;
+      if (!less_(value.Value, heap_[best].Value))
+        break;
+      Place(Hole, std::move(heap_[best]));
+      Hole = best;
+    }
+    Place(Hole, std::move(value));
+  }
+
+private:
+  Vector<Entry, al_> heap_;
+  /// ڶеλãڶʱΪnpos
+  Vector<size_t, al_> positions_;
+  /// ʹõľ
+  Vector<handle_type, al_> free_;
+  value_compare less_;
+};
+
+/// @brief:ValueЧλValueΪ0ʱ0
+inline unsigned BitWidth(uint64_t Value) {
+  if (Value == 0)
+    return 0;
+#ifdef _MSC_VER
+  unsigned long index;
+  _BitScanReverse64(&index, Value);
+  return index + 1;
+#else
+  return 64 - __builtin_clzll(Value);
+#endif
+}
+
+/// @brief:RadixHeapбԪأValueΪvoidʱֻ
+template <typename Key, typename Value> struct RadixHeapTraits {
+  using value_type = std::pair<Key, Value>;
+
+  static Key KeyOf(const value_type &Element) { return Element.first; }
+
+  template <typename BucketTy, typename... ValTy>
+  static void Emplace(BucketTy &Bucket, Key K, ValTy &&... V) {
+    Bucket.emplace_back(std::piecewise_construct, std::forward_as_tuple(K),
+                        std::forward_as_tuple(std::forward<ValTy>(V)...));
+  }
+};
+
+template <typename Key> struct RadixHeapTraits<Key, void> {
+  using value_type = Key;
+
+  static Key KeyOf(const value_type &Element) { return Element; }
+
+  template <typename BucketTy> static void Emplace(BucketTy &Bucket, Key K) {
+    Bucket.emplace_back(K);
+  }
+};
+
+/// @brief:ΪС
+/// Ԫذlast_(һȡС)ߵĲͬλֵͰУ
+/// Ͱ0еļlast_ѶֱӴͰ0ȡ
+/// Ͱ0ΪʱҵһǿյͰеСΪµlast_·Ͱ
+/// ÿԪֻᱻֵ͵ͰУÿβ̯O(log C)Ԫ֮䲻Ƚϡ
+/// ļСlast_DijkstraͰʱƽ¼С
+/// ValueΪvoidʱԪؾǼpush(Key)/top()/pop()PriorityQueueһ£
+/// ԪΪstd::pair<Key, Value>
+/// top()·Ͱƽlast_˲constԱ
+template <typename Key, typename Value = void,
+          typename AllocatorTy = Allocator>
+class RadixHeap {
+  static_assert(std::is_integral<Key>::value, "radix heap needs integer keys");
+
+public:
+  using traits = RadixHeapTraits<Key, Value>;
+  using key_type = Key;
+  using mapped_type = Value;
+  using value_type = typename traits::value_type;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+
+  using al_ = AllocatorTy;
+
+  /// Ͱiеļlast_߲ͬλΪi-1λ
+  static constexpr size_t NumBuckets = sizeof(Key) * 8 + 1;
+
+  /// ͰĳʼΪ1ұڶڲնѲڴ
+  using bucket_type = SmallVector<value_type, 1, al_>;
+
+public:
+  RadixHeap() {}
+
+  /// @brief:ͰʹAlڴ
+  explicit RadixHeap(const AllocatorTy &Al) {
+    for (bucket_type &bucket : buckets_)
+      bucket = bucket_type(Al);
+  }
+
+  /// ƶĶҪclear()¸ֵܼ֮ʹ
+  RadixHeap(const RadixHeap &) = default;
+  RadixHeap(RadixHeap &&) = default;
+  RadixHeap &operator=(const RadixHeap &) = default;
+  RadixHeap &operator=(RadixHeap &&) = default;
+
+  void push(const value_type &Element) {
+    Key key = traits::KeyOf(Element);
+    assert(key >= last_);
+    buckets_[Bucket(key)].push_back(Element);
+    ++size_;
+  }
+
+  void push(value_type &&Element) {
+    Key key = traits::KeyOf(Element);
+    assert(key >= last_);
+    buckets_[Bucket(key)].push_back(std::move(Element));
+    ++size_;
+  }
+
+  /// @brief:ΪKֵΪVԪ
+  template <typename MappedTy> void push(Key K, MappedTy &&V) {
+    emplace(K, std::forward<MappedTy>(V));
+  }
+
+  /// @brief:ԭعΪKԪأVΪValueĲ
+  template <typename... ValTy> void emplace(Key K, ValTy &&... V) {
+    assert(K >= last_);
+    traits::Emplace(buckets_[Bucket(K)], K, std::forward<ValTy>(V)...);
+    ++size_;
+  }
+
+  /// @brief:СԪأͰ0Ϊʱ·Ͱ
+  const value_type &top() {
+    assert(!empty());
+    Refill();
+    return buckets_[0].back();
+  }
+
+  Key top_key() { return traits::KeyOf(top()); }
+
+  void pop() {
+    assert(!empty());
+    Refill();
+    buckets_[0].pop_back();
+    --size_;
+  }
+
+  /// @brief:һȡС֮ļС
+  Key last_key() const { return last_; }
+
+  void clear() {
+    for (bucket_type &bucket : buckets_)
+      bucket.clear();
+    size_ = 0;
+    last_ = Key();
+  }
+
+  size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+
+private:
+  using unsigned_key = std::make_unsigned_t<Key>;
+
+  size_t Bucket(Key K) const {
+    return BitWidth((uint64_t)((unsigned_key)K ^ (unsigned_key)last_));
+  }
+
+  /// @brief:Ͱ0ΪʱԵһǿͰеСΪlast_·Ͱ
+  void Refill() {
+    if (buckets_[0].size() != 0)
+      return;
+    size_t index = 1;
+    while (buckets_[index].size() == 0)
+      ++index;
+    bucket_type &bucket = buckets_[index];
+    Key min_key = traits::KeyOf(bucket[0]);
+    for (size_t i = 1; i < bucket.size(); ++i) {
+      Key key = traits::KeyOf(bucket[i]);
+      min_key = key < min_key ? key : min_key;
+    }
+    last_ = min_key;
+    for (value_type &element : bucket)
+      buckets_[Bucket(traits::KeyOf(element))].push_back(std::move(element));
+    bucket.clear();
+  }
+
+private:
+  bucket_type buckets_[NumBuckets];
+  size_t size_ = 0;
+  Key last_ = Key();
+};
+
 } // namespace adt
\ No newline at end of file
@@ -0,0 +1,355 @@
+/**
+ * SegmentedVector: ֶ
+ * Ԫرɸ̶С(ChunkSizeԪأ2)ĿУָ뱣ڿ
+ * ±ͨλ붨λڣȻO(1)ʡ
+ * չʱֻ׷µĿ飬ԪشӲᶯԪصָ䱻Ƴ֮ǰһֱЧ
+ * ׷ӵĺʱҲʱּ塣
+ * ͷԪͨƫƼ¼鵯պͷŲڿգ
+ * յıﵽһʱƳͷ̯O(1)ΪQueueĵײ
+ * 
+ *	push_back		βԪ
+ *	pop_back		һԪ
+ *	pop_front		һԪ
+ *	front			һԪ
+ *	back			һԪ
+ *	clear			Ԫزͷп
+ **/
+#pragma once
+
+#include "Allocator.h"
+#include "Vector.h"
+#include <assert.h>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+namespace adt {
+
+/// @brief:ֶʵValueTyΪconst Tyʱǳ
+template <typename ValueTy, size_t ChunkSize> class SegmentedIterator {
+public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = std::remove_const_t<ValueTy>;
+  using pointer = ValueTy *;
+  using reference = ValueTy &;
+  using difference_type = ptrdiff_t;
+  using chunk_table = ValueTy *const *;
+
+public:
+  SegmentedIterator() : chunks_(nullptr), index_(0) {}
+
+  SegmentedIterator(chunk_table Chunks, size_t Index)
+      : chunks_(Chunks), index_(Index) {}
+
+  /// @brief:ǳתΪ
+  template <typename OtherTy, typename = std::enable_if_t<
+                                  std::is_same<const OtherTy, ValueTy>::value>>
+  SegmentedIterator(const SegmentedIterator<OtherTy, ChunkSize> &Another)
+      : chunks_(Another.chunks()), index_(Another.index()) {}
+
+  reference operator*() const {
+    return chunks_[index_ / ChunkSize][index_ % ChunkSize];
+  }
+
+  pointer operator->() const { return &**this; }
+
+  reference operator[](difference_type Offset) const {
+    return *(*this + Offset);
+  }
+
+  SegmentedIterator &operator++() {
+    ++index_;
+    return *this;
+  }
+
+  SegmentedIterator &operator--() {
+    --index_;
+    return *this;
+  }
+
+  const SegmentedIterator operator++(int) {
+    SegmentedIterator it = *this;
+    ++*this;
+    return it;
+  }
+
+  const SegmentedIterator operator--(int) {
+    SegmentedIterator it = *this;
+    --*this;
+    return it;
+  }
+
+  SegmentedIterator &operator+=(difference_type Offset) {
+    index_ += Offset;
+    return *this;
+  }
+
+  SegmentedIterator &operator-=(difference_type Offset) {
+    index_ -= Offset;
+    return *this;
+  }
+
+  SegmentedIterator operator+(difference_type Offset) const {
+    return SegmentedIterator(chunks_, index_ + Offset);
+  }
+
+  SegmentedIterator operator-(difference_type Offset) const {
+    return SegmentedIterator(chunks_, index_ - Offset);
+  }
+
+  difference_type operator-(const SegmentedIterator &Another) const {
+    return (difference_type)index_ - (difference_type)Another.index_;
+  }
+
+  bool operator==(const SegmentedIterator &Another) const {
+    return index_ == Another.index_;
+  }
+
+  bool operator!=(const SegmentedIterator &Another) const {
+    return index_ != Another.index_;
+  }
+
+  bool operator<(const SegmentedIterator &Another) const {
+    return index_ < Another.index_;
+  }
+
+  bool operator>(const SegmentedIterator &Another) const {
+    return index_ > Another.index_;
+  }
+
+  bool operator<=(const SegmentedIterator &Another) const {
+    return index_ <= Another.index_;
+  }
+
+  bool operator>=(const SegmentedIterator &Another) const {
+    return index_ >= Another.index_;
+  }
+
+  chunk_table chunks() const { return chunks_; }
+  size_t index() const { return index_; }
+
+private:
+  chunk_table chunks_;
+  /// ڵһʼλõ±꣬ͷѵƫ
+  size_t index_;
+};
+
+template <typename Ty, size_t ChunkSize = 1024,
+          typename AllocatorTy = Allocator>
+class SegmentedVector : private AllocatorHolder<AllocatorTy> {
+  static_assert(ChunkSize > 0 && (ChunkSize & (ChunkSize - 1)) == 0,
+                "chunk size must be a power of 2");
+
+public:
+  using value_type = Ty;
+  using reference = Ty &;
+  using const_reference = const Ty &;
+  using pointer = Ty *;
+  using const_pointer = const Ty *;
+  using iterator = SegmentedIterator<Ty, ChunkSize>;
+  using const_iterator = SegmentedIterator<const Ty, ChunkSize>;
+
+  using al_ = AllocatorTy;
+  using holder_ = AllocatorHolder<AllocatorTy>;
+
+public:
+  SegmentedVector() {}
+
+  explicit SegmentedVector(const AllocatorTy &Al)
+      : holder_(Al), chunks_(Al) {}
+
+  SegmentedVector(std::initializer_list<Ty> InitList,
+                  const AllocatorTy &Al = AllocatorTy())
+      : holder_(Al), chunks_(Al) {
+    append(InitList.begin(), InitList.end());
+  }
+
+  SegmentedVector(const SegmentedVector &Another)
+      : holder_(Another.GetAllocator()), chunks_(Another.GetAllocator()) {
+    append(Another.begin(), Another.end());
+  }
+
+  SegmentedVector(SegmentedVector &&Another)
+      : holder_(std::move(Another.GetAllocator())),
+        chunks_(std::move(Another.chunks_)), first_(Another.first_),
+        head_(Another.head_), size_(Another.size_), spare_(Another.spare_) {
+    Another.first_ = Another.head_ = Another.size_ = 0;
+    Another.spare_ = nullptr;
+  }
+
+  ~SegmentedVector() {
+    clear();
+    DeallocateChunk(spare_);
+  }
+
+  SegmentedVector &operator=(const SegmentedVector &Right) {
+    if (this == &Right)
+      return *this;
+    clear();
+    append(Right.begin(), Right.end());
+    return *this;
+  }
+
+  SegmentedVector &operator=(SegmentedVector &&Right) {
+    if (this == &Right)
+      return *this;
+    clear();
+    DeallocateChunk(spare_);
+    this->GetAllocator() = std::move(Right.GetAllocator());
+    chunks_ = std::move(Right.chunks_);
+    first_ = Right.first_;
+    head_ = Right.head_;
+    size_ = Right.size_;
+    spare_ = Right.spare_;
+    Right.first_ = Right.head_ = Right.size_ = 0;
+    Right.spare_ = nullptr;
+    return *this;
+  }
+
+  size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+
+  al_ get_allocator() const { return this->GetAllocator(); }
+
+  iterator begin() { return iterator(chunks_.data(), head_); }
+  iterator end() { return iterator(chunks_.data(), head_ + size_); }
+  const_iterator begin() const {
+    return const_iterator(chunks_.data(), head_);
+  }
+  const_iterator end() const {
+    return const_iterator(chunks_.data(), head_ + size_);
+  }
+
+  reference operator[](size_t Idx) {
+    assert(Idx < size_);
+    return At(head_ + Idx);
+  }
+
+  const_reference operator[](size_t Idx) const {
+    assert(Idx < size_);
+    return At(head_ + Idx);
+  }
+
+  reference front() {
+    assert(size_ > 0);
+    return At(head_);
+  }
+
+  const_reference front() const {
+    assert(size_ > 0);
+    return At(head_);
+  }
+
+  reference back() {
+    assert(size_ > 0);
+    return At(head_ + size_ - 1);
+  }
+
+  const_reference back() const {
+    assert(size_ > 0);
+    return At(head_ + size_ - 1);
+  }
+
+  void push_back(const Ty &Element) { emplace_back(Element); }
+
+  void push_back(Ty &&Element) { emplace_back(std::move(Element)); }
+
+  template <typename... ValTy> reference emplace_back(ValTy &&... Value) {
+    size_t index = head_ + size_;
+    if (index / ChunkSize == chunks_.size())
+      chunks_.push_back(AllocateChunk());
+    Ty *slot = &At(index);
+    ::new (slot) Ty(std::forward<ValTy>(Value)...);
+    ++size_;
+    return *slot;
+  }
+
+  /// @brief:[First,Last)Ԫӵβ
+  template <typename Iterator> void append(Iterator First, Iterator Last) {
+    for (Iterator it = First; it != Last; ++it)
+      emplace_back(*it);
+  }
+
+  /// @brief:һԪأһ鵯ʱͷ
+  void pop_back() {
+    assert(size_ > 0);
+    --size_;
+    std::destroy_at(&At(head_ + size_));
+    size_t used = (head_ + size_ + ChunkSize - 1) / ChunkSize;
+    if (chunks_.size() > used && chunks_.size() > 1) {
+      ReleaseChunk(chunks_.back());
+      chunks_.pop_back();
+    }
+  }
+
+  /// @brief:һԪأһ鵯ʱͷ
+  void pop_front() {
+    assert(size_ > 0);
+    std::destroy_at(&At(head_));
+    ++head_;
+    --size_;
+    if (head_ % ChunkSize == 0) {
+      ReleaseChunk(chunks_[first_]);
+      chunks_[first_++] = nullptr;
+      /// յıһʱƳᶯıѵյĿ
+      if (first_ * 2 >= chunks_.size()) {
+        chunks_.erase(chunks_.begin(), chunks_.begin() + first_);
+        head_ -= first_ * ChunkSize;
+        first_ = 0;
+      }
+    }
+  }
+
+  /// @brief:Ԫزͷп飬һп
+  void clear() {
+    for (size_t i = 0; i < size_; ++i)
+      std::destroy_at(&At(head_ + i));
+    for (size_t i = first_; i < chunks_.size(); ++i)
+      ReleaseChunk(chunks_[i]);
+    chunks_.clear();
+    first_ = head_ = size_ = 0;
+  }
+
+private:
+  Ty &At(size_t Index) const {
+    return chunks_[Index / ChunkSize][Index % ChunkSize];
+  }
+
+  Ty *AllocateChunk() {
+    if (spare_) {
+      Ty *chunk = spare_;
+      spare_ = nullptr;
+      return chunk;
+    }
+    return (Ty *)AllocatorTraits<al_>::AllocateBuffer(
+        this->GetAllocator(), ChunkSize * sizeof(Ty), alignof(Ty));
+  }
+
+  void DeallocateChunk(Ty *Chunk) {
+    if (!Chunk)
+      return;
+    AllocatorTraits<al_>::DeallocateBuffer(
+        this->GetAllocator(), Chunk, ChunkSize * sizeof(Ty), alignof(Ty));
+  }
+
+  /// @brief:黹һտ飬һпڿ߽Ϸͷ
+  void ReleaseChunk(Ty *Chunk) {
+    if (!spare_)
+      spare_ = Chunk;
+    else
+      DeallocateChunk(Chunk);
+  }
+
+private:
+  Vector<Ty *, al_> chunks_;
+  /// һδյĿڿеλã֮ǰıΪ
+  size_t first_ = 0;
+  /// һԪڿʼλõ±
+  size_t head_ = 0;
+  size_t size_ = 0;
+  Ty *spare_ = nullptr;
+};
+
+} // namespace adt
\ No newline at end of file
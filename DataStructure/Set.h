@@ -14,13 +14,16 @@ public:
 public:
   Set() {}
 
+  explicit Set(const AllocatorTy &Al) : BSTAvlImpl<Ty, AllocatorTy>(Al) {}
+
   template <typename Iterator> Set(Iterator First, Iterator Last) {
     for (Iterator it = First; it != Last; ++it) {
       this->insert(*it);
     }
   }
 
-  Set(const Set &Another) {
+  Set(const Set &Another)
+      : BSTAvlImpl<Ty, AllocatorTy>(Another.get_allocator()) {
     for (const_iterator it = Another.begin(); it != Another.end(); ++it) {
       this->insert(*it);
     }
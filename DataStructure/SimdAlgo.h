@@ -0,0 +1,522 @@
+/**
+ * SimdAlgo: ĲҺ͹Լ㷨
+ * int32_tfloat(Vector[begin,end))ʱͨCPUIDѡ
+ * AVX2SSE2ʵ֣x86ƽֻ̨ʹñʵ֡
+ * 
+ *	find			ҵһValueԪأûʱLast
+ *	count			ͳƵValueԪظ
+ *	min_element		һСԪأΪʱLast
+ *	max_element		һԪأΪʱLast
+ *	accumulate		ͣint32_tۼӵint64_tfloatۼӵdouble
+ *	find_byte		memchrҵһByteֽڣûʱnullptr
+ * ע⣺
+ *	min_element/max_elementҪûNaN
+ *	floataccumulate·ۼӣ˳ۼӲͬ
+ **/
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(_M_X64) || defined(__x86_64__) || defined(_M_IX86) ||            \
+    defined(__i386__)
+#define ADT_SIMD_X86 1
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define ADT_TARGET_SSE2
+#define ADT_TARGET_AVX2
+#else
+#include <cpuid.h>
+#define ADT_TARGET_SSE2 __attribute__((target("sse2")))
+#define ADT_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace adt {
+namespace simd {
+
+struct CpuFeatures {
+  bool Sse2 = false;
+  bool Avx2 = false;
+};
+
+#ifdef ADT_SIMD_X86
+inline void Cpuid(unsigned Leaf, unsigned SubLeaf, unsigned Regs[4]) {
+#ifdef _MSC_VER
+  __cpuidex((int *)Regs, (int)Leaf, (int)SubLeaf);
+#else
+  __cpuid_count(Leaf, SubLeaf, Regs[0], Regs[1], Regs[2], Regs[3]);
+#endif
+}
+
+/// @brief:ȡXCR0жϲϵͳǷ񱣴YMMĴ
+inline uint64_t Xgetbv() {
+#ifdef _MSC_VER
+  return _xgetbv(0);
+#else
+  unsigned eax, edx;
+  __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+  return ((uint64_t)edx << 32) | eax;
+#endif
+}
+
+inline unsigned CountTrailingZeros(unsigned Mask) {
+#ifdef _MSC_VER
+  unsigned long index;
+  _BitScanForward(&index, Mask);
+  return index;
+#else
+  return __builtin_ctz(Mask);
+#endif
+}
+#endif
+
+inline CpuFeatures DetectCpuFeatures() {
+  CpuFeatures features;
+#ifdef ADT_SIMD_X86
+  unsigned regs[4];
+  Cpuid(0, 0, regs);
+  unsigned max_leaf = regs[0];
+  Cpuid(1, 0, regs);
+  features.Sse2 = (regs[3] >> 26) & 1;
+  bool osxsave = (regs[2] >> 27) & 1;
+  bool avx = (regs[2] >> 28) & 1;
+  if (max_leaf >= 7 && osxsave && avx && (Xgetbv() & 6) == 6) {
+    Cpuid(7, 0, regs);
+    features.Avx2 = (regs[1] >> 5) & 1;
+  }
+#endif
+  return features;
+}
+
+/// @brief:ǰCPUֵָ֧ֻһ
+inline const CpuFeatures &GetCpuFeatures() {
+  static const CpuFeatures features = DetectCpuFeatures();
+  return features;
+}
+
+/// ʵ֣ҲڴѭʣµβԪ
+
+template <typename Ty>
+const Ty *FindScalar(const Ty *First, const Ty *Last, Ty Value) {
+  for (; First != Last; ++First)
+    if (*First == Value)
+      return First;
+  return Last;
+}
+
+template <typename Ty>
+size_t CountScalar(const Ty *First, const Ty *Last, Ty Value) {
+  size_t count = 0;
+  for (; First != Last; ++First)
+    count += *First == Value;
+  return count;
+}
+
+template <typename Ty> Ty MinScalar(const Ty *First, const Ty *Last, Ty Init) {
+  for (; First != Last; ++First)
+    if (*First < Init)
+      Init = *First;
+  return Init;
+}
+
+template <typename Ty> Ty MaxScalar(const Ty *First, const Ty *Last, Ty Init) {
+  for (; First != Last; ++First)
+    if (Init < *First)
+      Init = *First;
+  return Init;
+}
+
+template <typename Ty, typename SumTy>
+SumTy AccumulateScalar(const Ty *First, const Ty *Last, SumTy Init) {
+  for (; First != Last; ++First)
+    Init += *First;
+  return Init;
+}
+
+inline const unsigned char *FindByteScalar(const unsigned char *First,
+                                           const unsigned char *Last,
+                                           unsigned char Byte) {
+  for (; First != Last; ++First)
+    if (*First == Byte)
+      return First;
+  return nullptr;
+}
+
+#ifdef ADT_SIMD_X86
+/// SSE2ʵ
+
+ADT_TARGET_SSE2 inline const int32_t *
+FindSse2(const int32_t *First, const int32_t *Last, int32_t Value) {
+  __m128i needle = _mm_set1_epi32(Value);
+  for (; Last - First >= 4; First += 4) {
+    __m128i v = _mm_loadu_si128((const __m128i *)First);
+    int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(v, needle)));
+    if (mask)
+      return First + CountTrailingZeros(mask);
+  }
+  return FindScalar(First, Last, Value);
+}
+
+ADT_TARGET_SSE2 inline const float *FindSse2(const float *First,
+                                             const float *Last, float Value) {
+  __m128 needle = _mm_set1_ps(Value);
+  for (; Last - First >= 4; First += 4) {
+    int mask = _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(First), needle));
+    if (mask)
+      return First + CountTrailingZeros(mask);
+  }
+  return FindScalar(First, Last, Value);
+}
+
+ADT_TARGET_SSE2 inline size_t HorizontalSumSse2(__m128i Counts) {
+  uint32_t lanes[4];
+  _mm_storeu_si128((__m128i *)lanes, Counts);
+  return (size_t)lanes[0] + lanes[1] + lanes[2] + lanes[3];
+}
+
+ADT_TARGET_SSE2 inline size_t CountSse2(const int32_t *First,
+                                        const int32_t *Last, int32_t Value) {
+  __m128i needle = _mm_set1_epi32(Value);
+  __m128i counts = _mm_setzero_si128();
+  /// ȵͨΪ-1ȥһ
+  for (; Last - First >= 4; First += 4) {
+    __m128i v = _mm_loadu_si128((const __m128i *)First);
+    counts = _mm_sub_epi32(counts, _mm_cmpeq_epi32(v, needle));
+  }
+  return HorizontalSumSse2(counts) + CountScalar(First, Last, Value);
+}
+
+ADT_TARGET_SSE2 inline size_t CountSse2(const float *First, const float *Last,
+                                        float Value) {
+  __m128 needle = _mm_set1_ps(Value);
+  __m128i counts = _mm_setzero_si128();
+  for (; Last - First >= 4; First += 4) {
+    __m128 eq = _mm_cmpeq_ps(_mm_loadu_ps(First), needle);
+    counts = _mm_sub_epi32(counts, _mm_castps_si128(eq));
+  }
+  return HorizontalSumSse2(counts) + CountScalar(First, Last, Value);
+}
+
+/// @brief:SSE2ûpminsd/pmaxsdñȽϺѡ
+ADT_TARGET_SSE2 inline __m128i SelectSse2(__m128i Mask, __m128i A, __m128i B) {
+  return _mm_or_si128(_mm_and_si128(Mask, A), _mm_andnot_si128(Mask, B));
+}
+
+ADT_TARGET_SSE2 inline int32_t MinSse2(const int32_t *First,
+                                       const int32_t *Last, int32_t Init) {
+  __m128i best = _mm_set1_epi32(Init);
+  for (; Last - First >= 4; First += 4) {
+    __m128i v = _mm_loadu_si128((const __m128i *)First);
+    best = SelectSse2(_mm_cmplt_epi32(v, best), v, best);
+  }
+  int32_t lanes[4];
+  _mm_storeu_si128((__m128i *)lanes, best);
+  return MinScalar(First, Last, MinScalar(lanes, lanes + 4, Init));
+}
+
+ADT_TARGET_SSE2 inline int32_t MaxSse2(const int32_t *First,
+                                       const int32_t *Last, int32_t Init) {
+  __m128i best = _mm_set1_epi32(Init);
+  for (; Last - First >= 4; First += 4) {
+    __m128i v = _mm_loadu_si128((const __m128i *)First);
+    best = SelectSse2(_mm_cmpgt_epi32(v, best), v, best);
+  }
+  int32_t lanes[4];
+  _mm_storeu_si128((__m128i *)lanes, best);
+  return MaxScalar(First, Last, MaxScalar(lanes, lanes + 4, Init));
+}
+
+ADT_TARGET_SSE2 inline float MinSse2(const float *First, const float *Last,
+                                     float Init) {
+  __m128 best = _mm_set1_ps(Init);
+  for (; Last - First >= 4; First += 4)
+    best = _mm_min_ps(best, _mm_loadu_ps(First));
+  float lanes[4];
+  _mm_storeu_ps(lanes, best);
+  return MinScalar(First, Last, MinScalar(lanes, lanes + 4, Init));
+}
+
+ADT_TARGET_SSE2 inline float MaxSse2(const float *First, const float *Last,
+                                     float Init) {
+  __m128 best = _mm_set1_ps(Init);
+  for (; Last - First >= 4; First += 4)
+    best = _mm_max_ps(best, _mm_loadu_ps(First));
+  float lanes[4];
+  _mm_storeu_ps(lanes, best);
+  return MaxScalar(First, Last, MaxScalar(lanes, lanes + 4, Init));
+}
+
+ADT_TARGET_SSE2 inline int64_t AccumulateSse2(const int32_t *First,
+                                              const int32_t *Last,
+                                              int64_t Init) {
+  __m128i sum = _mm_setzero_si128();
+  for (; Last - First >= 4; First += 4) {
+    __m128i v = _mm_loadu_si128((const __m128i *)First);
+    /// ÷λչ64λ
+    __m128i sign = _mm_srai_epi32(v, 31);
+    sum = _mm_add_epi64(sum, _mm_unpacklo_epi32(v, sign));
+    sum = _mm_add_epi64(sum, _mm_unpackhi_epi32(v, sign));
+  }
+  int64_t lanes[2];
+  _mm_storeu_si128((__m128i *)lanes, sum);
+  return AccumulateScalar(First, Last, Init + lanes[0] + lanes[1]);
+}
+
+ADT_TARGET_SSE2 inline double AccumulateSse2(const float *First,
+                                             const float *Last, double Init) {
+  __m128d sum = _mm_setzero_pd();
+  for (; Last - First >= 4; First += 4) {
+    __m128 v = _mm_loadu_ps(First);
+    sum = _mm_add_pd(sum, _mm_cvtps_pd(v));
+    sum = _mm_add_pd(sum, _mm_cvtps_pd(_mm_movehl_ps(v, v)));
+  }
+  double lanes[2];
+  _mm_storeu_pd(lanes, sum);
+  return AccumulateScalar(First, Last, Init + lanes[0] + lanes[1]);
+}
+
+ADT_TARGET_SSE2 inline const unsigned char *
+FindByteSse2(const unsigned char *First, const unsigned char *Last,
+             unsigned char Byte) {
+  __m128i needle = _mm_set1_epi8((char)Byte);
+  for (; Last - First >= 16; First += 16) {
+    __m128i v = _mm_loadu_si128((const __m128i *)First);
+    int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(v, needle));
+    if (mask)
+      return First + CountTrailingZeros(mask);
+  }
+  return FindByteScalar(First, Last, Byte);
+}
+
+/// AVX2ʵ
+
+ADT_TARGET_AVX2 inline const int32_t *
+FindAvx2(const int32_t *First, const int32_t *Last, int32_t Value) {
+  __m256i needle = _mm256_set1_epi32(Value);
+  for (; Last - First >= 8; First += 8) {
+    __m256i v = _mm256_loadu_si256((const __m256i *)First);
+    int mask = _mm256_movemask_ps(
+        _mm256_castsi256_ps(_mm256_cmpeq_epi32(v, needle)));
+    if (mask)
+      return First + CountTrailingZeros(mask);
+  }
+  return FindScalar(First, Last, Value);
+}
+
+ADT_TARGET_AVX2 inline const float *FindAvx2(const float *First,
+                                             const float *Last, float Value) {
+  __m256 needle = _mm256_set1_ps(Value);
+  for (; Last - First >= 8; First += 8) {
+    __m256 eq = _mm256_cmp_ps(_mm256_loadu_ps(First), needle, _CMP_EQ_OQ);
+    int mask = _mm256_movemask_ps(eq);
+    if (mask)
+      return First + CountTrailingZeros(mask);
+  }
+  return FindScalar(First, Last, Value);
+}
+
+ADT_TARGET_AVX2 inline size_t HorizontalSumAvx2(__m256i Counts) {
+  uint32_t lanes[8];
+  _mm256_storeu_si256((__m256i *)lanes, Counts);
+  size_t sum = 0;
+  for (size_t i = 0; i < 8; ++i)
+    sum += lanes[i];
+  return sum;
+}
+
+ADT_TARGET_AVX2 inline size_t CountAvx2(const int32_t *First,
+                                        const int32_t *Last, int32_t Value) {
+  __m256i needle = _mm256_set1_epi32(Value);
+  __m256i counts = _mm256_setzero_si256();
+  for (; Last - First >= 8; First += 8) {
+    __m256i v = _mm256_loadu_si256((const __m256i *)First);
+    counts = _mm256_sub_epi32(counts, _mm256_cmpeq_epi32(v, needle));
+  }
+  return HorizontalSumAvx2(counts) + CountScalar(First, Last, Value);
+}
+
+ADT_TARGET_AVX2 inline size_t CountAvx2(const float *First, const float *Last,
+                                        float Value) {
+  __m256 needle = _mm256_set1_ps(Value);
+  __m256i counts = _mm256_setzero_si256();
+  for (; Last - First >= 8; First += 8) {
+    __m256 eq = _mm256_cmp_ps(_mm256_loadu_ps(First), needle, _CMP_EQ_OQ);
+    counts = _mm256_sub_epi32(counts, _mm256_castps_si256(eq));
+  }
+  return HorizontalSumAvx2(counts) + CountScalar(First, Last, Value);
+}
+
+ADT_TARGET_AVX2 inline int32_t MinAvx2(const int32_t *First,
+                                       const int32_t *Last, int32_t Init) {
+  __m256i best = _mm256_set1_epi32(Init);
+  for (; Last - First >= 8; First += 8)
+    best = _mm256_min_epi32(best,
+                            _mm256_loadu_si256((const __m256i *)First));
+  int32_t lanes[8];
+  _mm256_storeu_si256((__m256i *)lanes, best);
+  return MinScalar(First, Last, MinScalar(lanes, lanes + 8, Init));
+}
+
+ADT_TARGET_AVX2 inline int32_t MaxAvx2(const int32_t *First,
+                                       const int32_t *Last, int32_t Init) {
+  __m256i best = _mm256_set1_epi32(Init);
+  for (; Last - First >= 8; First += 8)
+    best = _mm256_max_epi32(best,
+                            _mm256_loadu_si256((const __m256i *)First));
+  int32_t lanes[8];
+  _mm256_storeu_si256((__m256i *)lanes, best);
+  return MaxScalar(First, Last, MaxScalar(lanes, lanes + 8, Init));
+}
+
+ADT_TARGET_AVX2 inline float MinAvx2(const float *First, const float *Last,
+                                     float Init) {
+  __m256 best = _mm256_set1_ps(Init);
+  for (; Last - First >= 8; First += 8)
+    best = _mm256_min_ps(best, _mm256_loadu_ps(First));
+  float lanes[8];
+  _mm256_storeu_ps(lanes, best);
+  return MinScalar(First, Last, MinScalar(lanes, lanes + 8, Init));
+}
+
+ADT_TARGET_AVX2 inline float MaxAvx2(const float *First, const float *Last,
+                                     float Init) {
+  __m256 best = _mm256_set1_ps(Init);
+  for (; Last - First >= 8; First += 8)
+    best = _mm256_max_ps(best, _mm256_loadu_ps(First));
+  float lanes[8];
+  _mm256_storeu_ps(lanes, best);
+  return MaxScalar(First, Last, MaxScalar(lanes, lanes + 8, Init));
+}
+
+ADT_TARGET_AVX2 inline int64_t AccumulateAvx2(const int32_t *First,
+                                              const int32_t *Last,
+                                              int64_t Init) {
+  __m256i sum = _mm256_setzero_si256();
+  for (; Last - First >= 8; First += 8) {
+    __m256i v = _mm256_loadu_si256((const __m256i *)First);
+    sum = _mm256_add_epi64(
+        sum, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)));
+    sum = _mm256_add_epi64(
+        sum, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1)));
+  }
+  int64_t lanes[4];
+  _mm256_storeu_si256((__m256i *)lanes, sum);
+  return AccumulateScalar(First, Last,
+                          Init + lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+}
+
+ADT_TARGET_AVX2 inline double AccumulateAvx2(const float *First,
+                                             const float *Last, double Init) {
+  __m256d sum = _mm256_setzero_pd();
+  for (; Last - First >= 8; First += 8) {
+    sum = _mm256_add_pd(sum, _mm256_cvtps_pd(_mm_loadu_ps(First)));
+    sum = _mm256_add_pd(sum, _mm256_cvtps_pd(_mm_loadu_ps(First + 4)));
+  }
+  double lanes[4];
+  _mm256_storeu_pd(lanes, sum);
+  return AccumulateScalar(First, Last,
+                          Init + lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+}
+
+ADT_TARGET_AVX2 inline const unsigned char *
+FindByteAvx2(const unsigned char *First, const unsigned char *Last,
+             unsigned char Byte) {
+  __m256i needle = _mm256_set1_epi8((char)Byte);
+  for (; Last - First >= 32; First += 32) {
+    __m256i v = _mm256_loadu_si256((const __m256i *)First);
+    unsigned mask =
+        (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, needle));
+    if (mask)
+      return First + CountTrailingZeros(mask);
+  }
+  return FindByteSse2(First, Last, Byte);
+}
+#endif
+
+/// CPUֵָ֧
+#ifdef ADT_SIMD_X86
+#define ADT_SIMD_DISPATCH(Name, ...)                                           \
+  do {                                                                         \
+    if (GetCpuFeatures().Avx2)                                                 \
+      return Name##Avx2(__VA_ARGS__);                                          \
+    if (GetCpuFeatures().Sse2)                                                 \
+      return Name##Sse2(__VA_ARGS__);                                          \
+    return Name##Scalar(__VA_ARGS__);                                          \
+  } while (0)
+#else
+#define ADT_SIMD_DISPATCH(Name, ...) return Name##Scalar(__VA_ARGS__)
+#endif
+
+inline const int32_t *find(const int32_t *First, const int32_t *Last,
+                           int32_t Value) {
+  ADT_SIMD_DISPATCH(Find, First, Last, Value);
+}
+
+inline const float *find(const float *First, const float *Last, float Value) {
+  ADT_SIMD_DISPATCH(Find, First, Last, Value);
+}
+
+inline size_t count(const int32_t *First, const int32_t *Last,
+                    int32_t Value) {
+  ADT_SIMD_DISPATCH(Count, First, Last, Value);
+}
+
+inline size_t count(const float *First, const float *Last, float Value) {
+  ADT_SIMD_DISPATCH(Count, First, Last, Value);
+}
+
+inline int32_t MinValue(const int32_t *First, const int32_t *Last) {
+  ADT_SIMD_DISPATCH(Min, First, Last, *First);
+}
+
+inline float MinValue(const float *First, const float *Last) {
+  ADT_SIMD_DISPATCH(Min, First, Last, *First);
+}
+
+inline int32_t MaxValue(const int32_t *First, const int32_t *Last) {
+  ADT_SIMD_DISPATCH(Max, First, Last, *First);
+}
+
+inline float MaxValue(const float *First, const float *Last) {
+  ADT_SIMD_DISPATCH(Max, First, Last, *First);
+}
+
+/// @brief:СֵٲҵһСֵԪأɨ趼
+inline const int32_t *min_element(const int32_t *First, const int32_t *Last) {
+  return First == Last ? Last : find(First, Last, MinValue(First, Last));
+}
+
+inline const float *min_element(const float *First, const float *Last) {
+  return First == Last ? Last : find(First, Last, MinValue(First, Last));
+}
+
+inline const int32_t *max_element(const int32_t *First, const int32_t *Last) {
+  return First == Last ? Last : find(First, Last, MaxValue(First, Last));
+}
+
+inline const float *max_element(const float *First, const float *Last) {
+  return First == Last ? Last : find(First, Last, MaxValue(First, Last));
+}
+
+inline int64_t accumulate(const int32_t *First, const int32_t *Last,
+                          int64_t Init = 0) {
+  ADT_SIMD_DISPATCH(Accumulate, First, Last, Init);
+}
+
+inline double accumulate(const float *First, const float *Last,
+                         double Init = 0) {
+  ADT_SIMD_DISPATCH(Accumulate, First, Last, Init);
+}
+
+inline const void *find_byte(const void *Buffer, size_t Size,
+                             unsigned char Byte) {
+  const unsigned char *first = (const unsigned char *)Buffer;
+  ADT_SIMD_DISPATCH(FindByte, first, first + Size, Byte);
+}
+
+#undef ADT_SIMD_DISPATCH
+
+} // namespace simd
+} // namespace adt
\ No newline at end of file
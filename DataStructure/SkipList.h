@@ -25,11 +25,6 @@ public:
 
   template <typename... ValTy>
   SkipListNode(ValTy &&... Val) : Value(std::forward<ValTy>(Val)...) {}
-
-  ~SkipListNode() {
-    Value.~Ty();
-    Linkage.~vector();
-  }
 };
 
 template <class Ty, bool Const> class SkipListIterator {
@@ -90,7 +85,8 @@ private:
   node_ptr cur_, head_;
 };
 
-template <typename Ty, typename AllocatorTy = Allocator> class SkipList {
+template <typename Ty, typename AllocatorTy = Allocator>
+class SkipList : private AllocatorHolder<AllocatorTy> {
 public:
   using node = SkipListNode<Ty>;
   using node_ptr = SkipListNode<Ty> *;
@@ -100,11 +96,17 @@ public:
   using iterator = SkipListIterator<Ty, false>;
   using const_iterator = SkipListIterator<Ty, true>;
   using al_ = AllocatorTy;
+  using holder_ = AllocatorHolder<AllocatorTy>;
 
 public:
   SkipList() { InitializeRangeTable(); }
 
-  SkipList(const SkipList &Another) {
+  explicit SkipList(const AllocatorTy &Al) : holder_(Al) {
+    InitializeRangeTable();
+  }
+
+  SkipList(const SkipList &Another) : holder_(Another.GetAllocator()) {
+    InitializeRangeTable();
     for (iterator it = Another.begin(); it != Another.end(); ++it) {
       push(*it);
     }
@@ -113,6 +115,8 @@ public:
   size_t size() const { return size_; }
   bool empty() const { return !size(); }
 
+  al_ get_allocator() const { return this->GetAllocator(); }
+
   iterator begin() {
     assert(size() != 0);
     return iterator(Head()->Succ(0), Head());
@@ -183,8 +187,7 @@ public:
     node_ptr cur = Head()->Succ(0);
     while (cur != Head()) {
       node_ptr next = cur->Succ(0);
-      cur->~SkipListNode();
-      al_::Deallocate(cur);
+      DeleteNode(cur);
       cur = next;
     }
     size_ = 0;
@@ -275,6 +278,7 @@ private:
       }
       Node->Prev(i)->Succ(i) = Node->Succ(i);
     }
+    DeleteNode(Node);
     DecrementSize();
   }
 
@@ -286,11 +290,17 @@ private:
 
   /// @brief һ½
   template <typename... ValTy> node_ptr AllocateNode(ValTy &&... Value) {
-    node_ptr NewNode = (node_ptr)al_::Allocate(sizeof(node));
+    node_ptr NewNode = (node_ptr)this->GetAllocator().Allocate(sizeof(node));
     ::new (NewNode) node(std::forward<ValTy>(Value)...);
     return NewNode;
   }
 
+  /// @brief ٲͷһ
+  void DeleteNode(node_ptr Node) {
+    Node->~SkipListNode();
+    this->GetAllocator().Deallocate(Node, sizeof(node));
+  }
+
   /// @brief ѰValueλ
   /// @return ͷڵָ룬ûҵ
   /// @return Valueеλ
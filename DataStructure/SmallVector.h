@@ -0,0 +1,156 @@
+/**
+ * SmallVector: 洢
+ * ǰNԪرڶڲĻУҪڴ棻
+ * ԪظNʱתƵϣ֮VectorΪͬ
+ * ʺԪظͨٵʱڲջ
+ **/
+#pragma once
+
+#include "Vector.h"
+
+namespace adt {
+
+template <typename Ty, size_t N, typename AllocatorTy = Allocator,
+          typename GrowthTy = DefaultGrowth>
+class SmallVector
+    : public VectorBase<Ty, SmallVector<Ty, N, AllocatorTy, GrowthTy>>,
+      private AllocatorHolder<AllocatorTy> {
+  friend class VectorBase<Ty, SmallVector>;
+
+public:
+  using al_ = AllocatorTy;
+  using holder_ = AllocatorHolder<AllocatorTy>;
+
+public:
+  SmallVector() { ResetToInline(); }
+
+  explicit SmallVector(const AllocatorTy &Al) : holder_(Al) {
+    ResetToInline();
+  }
+
+  explicit SmallVector(size_t InitSize, const AllocatorTy &Al = AllocatorTy())
+      : holder_(Al) {
+    ResetToInline();
+    this->resize(InitSize);
+  }
+
+  explicit SmallVector(size_t InitSize, const Ty &Init,
+                       const AllocatorTy &Al = AllocatorTy())
+      : holder_(Al) {
+    ResetToInline();
+    this->append(InitSize, Init);
+  }
+
+  SmallVector(std::initializer_list<Ty> InitList,
+              const AllocatorTy &Al = AllocatorTy())
+      : holder_(Al) {
+    ResetToInline();
+    this->append(InitList.begin(), InitList.end());
+  }
+
+  SmallVector(const SmallVector &Another) : holder_(Another.GetAllocator()) {
+    ResetToInline();
+    this->append(Another.begin(), Another.end());
+  }
+
+  SmallVector(SmallVector &&Another)
+      : holder_(std::move(Another.GetAllocator())) {
+    ResetToInline();
+    TakeFrom(Another);
+  }
+
+  ~SmallVector() {
+    std::destroy(this->begin(), this->end());
+    FreeHeap();
+  }
+
+  SmallVector &operator=(const SmallVector &Right) {
+    if (this != &Right)
+      this->assign(Right.begin(), Right.end());
+    return *this;
+  }
+
+  SmallVector &operator=(SmallVector &&Right) {
+    if (this == &Right)
+      return *this;
+    this->clear();
+    FreeHeap();
+    ResetToInline();
+    this->GetAllocator() = std::move(Right.GetAllocator());
+    TakeFrom(Right);
+    return *this;
+  }
+
+  al_ get_allocator() const { return this->GetAllocator(); }
+
+  /// @brief:ԪǷ񻹱
+  bool is_small() const { return this->data_ == InlineBuffer(); }
+
+  /// @brief:ǰСԪظNʱ
+  void shrink_to_fit() {
+    if (is_small() || this->size_ == this->capacity_)
+      return;
+    bool to_inline = this->size_ <= N;
+    Ty *new_data = to_inline ? InlineBuffer() : AllocateHeap(this->size_);
+    Relocate(this->begin(), this->end(), new_data);
+    FreeHeap();
+    this->data_ = new_data;
+    this->capacity_ = to_inline ? N : this->size_;
+  }
+
+private:
+  Ty *InlineBuffer() const { return (Ty *)inline_; }
+
+  void ResetToInline() {
+    this->data_ = InlineBuffer();
+    this->size_ = 0;
+    this->capacity_ = N;
+  }
+
+  Ty *AllocateHeap(size_t Count) {
+    return (Ty *)AllocatorTraits<al_>::AllocateBuffer(
+        this->GetAllocator(), Count * sizeof(Ty), alignof(Ty));
+  }
+
+  /// @brief:ͷŶϵĻԪҪ
+  void FreeHeap() {
+    if (is_small())
+      return;
+    AllocatorTraits<al_>::DeallocateBuffer(this->GetAllocator(), this->data_,
+                                           this->capacity_ * sizeof(Ty),
+                                           alignof(Ty));
+  }
+
+  /// @brief:ӹAnotherԪأAnotherΪյ״̬
+  /// @note:ǰǰΪյ״̬
+  void TakeFrom(SmallVector &Another) {
+    if (Another.is_small()) {
+      Relocate(Another.begin(), Another.end(), this->data_);
+      this->size_ = Another.size_;
+    } else {
+      this->data_ = Another.data_;
+      this->size_ = Another.size_;
+      this->capacity_ = Another.capacity_;
+    }
+    Another.ResetToInline();
+  }
+
+  /// @brief:չԿռ䣬״չʱᵽ
+  void grow(size_t Size) {
+    if (this->capacity_ >= Size)
+      return;
+    size_t new_cap =
+        GrowthTy::NewCapacity(this->capacity_, Size, sizeof(Ty));
+
+    Ty *new_data = AllocateHeap(new_cap);
+    Relocate(this->begin(), this->end(), new_data);
+    FreeHeap();
+    this->data_ = new_data;
+    this->capacity_ = new_cap;
+  }
+
+private:
+  alignas(Ty) char inline_[(N ? N : 1) * sizeof(Ty)];
+};
+
+} // namespace adt
\ No newline at end of file
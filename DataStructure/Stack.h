@@ -6,6 +6,7 @@
  *	top		ջԪ
  *	size	ջǰС
  *	empty	ջǷΪ
+ * ײĬΪVectorԪظͨʱʹSmallVectorڴ
  **/
 #pragma once
 
@@ -14,7 +15,9 @@
 
 namespace adt {
 
-template <typename Ty, typename AllocatorTy = Allocator> class Stack {
+template <typename Ty, typename AllocatorTy = Allocator,
+          typename ContainerTy = Vector<Ty, AllocatorTy>>
+class Stack {
 public:
   using reference = Ty &;
   using const_reference = const Ty &;
@@ -22,27 +25,32 @@ public:
   using const_pointer = const Ty *;
 
   using al_ = AllocatorTy;
+  using container_type = ContainerTy;
 
 public:
   Stack() : container_() {}
   Stack(size_t InitSize) : container_(InitSize) {}
 
-  Stack(const Stack &Another) {
+  explicit Stack(const AllocatorTy &Al) : container_(Al) {}
+
+  Stack(const Stack &Another) : container_(Another.get_allocator()) {
     for (auto iter = Another.container_.begin();
          iter != Another.container_.end(); ++iter) {
       push(*iter);
     }
   }
 
-  Stack(Stack &&Another) { container_ = std::move(Another.container_); }
+  Stack(Stack &&Another) : container_(std::move(Another.container_)) {}
 
-  void push(Ty &&Element) { container_.push_back(Element); }
+  void push(Ty &&Element) { container_.push_back(std::move(Element)); }
   void push(const Ty &Element) { container_.push_back(Element); }
   void pop() { container_.pop_back(); }
 
   size_t size() const { return container_.size(); }
   bool empty() const { return size() == 0; }
 
+  al_ get_allocator() const { return container_.get_allocator(); }
+
   /// @brief:ջԪ
   Ty &top() {
     assert(this->size() != 0);
@@ -51,11 +59,11 @@ public:
 
   /// @brief:push an element
   template <typename... ValTy> void emplace(ValTy &&... Value) {
-    container_.emplace_back(Value);
+    container_.emplace_back(std::forward<ValTy>(Value)...);
   }
 
 private:
-  Vector<Ty, al_> container_;
+  ContainerTy container_;
 };
 
 } // namespace adt
\ No newline at end of file
@@ -0,0 +1,161 @@
+/**
+ * ThreadCacheAllocator: ̻߳
+ * ÿ߳Ϊÿߴȼάһؿ(magazine)ͷŶ
+ * ΪʱӹDepotȡһڴ飬ʱ黹һ顣
+ * ڴ鲻ĳ̣߳A̷߳䡢B߳ͷŵڴB̵߳Ļ棬
+ * ֮ͨDepot֮߳ת߳˳ʱػȫ黹Depot
+ * ߴȼPoolͬPool::MaxSmallSizeֱתAllocator
+ **/
+#pragma once
+
+#include "Allocator.h"
+#include "PoolAllocator.h"
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
+namespace adt {
+
+class ThreadCacheAllocator {
+public:
+  static constexpr size_t NumClasses = Pool::NumClasses;
+
+public:
+  static char *Allocate(size_t Size) {
+    if (Size > Pool::MaxSmallSize)
+      return Allocator::Allocate(Size);
+    size_t index = Pool::ClassIndex(Size);
+    Bin &bin = GetThreadCache().Bins[index];
+    if (!bin.Head) {
+      Magazine mag = GetDepot().Fetch(index);
+      bin.Head = mag.Head;
+      bin.Count = mag.Count;
+    }
+    FreeBlock *block = bin.Head;
+    bin.Head = block->Next;
+    --bin.Count;
+    return (char *)block;
+  }
+
+  static void Deallocate(void *Buffer, size_t Size) {
+    if (!Buffer)
+      return;
+    if (Size > Pool::MaxSmallSize) {
+      Allocator::Deallocate(Buffer, Size);
+      return;
+    }
+    size_t index = Pool::ClassIndex(Size);
+    Bin &bin = GetThreadCache().Bins[index];
+    FreeBlock *block = (FreeBlock *)Buffer;
+    block->Next = bin.Head;
+    bin.Head = block;
+    ++bin.Count;
+    /// ػ泬ʱ黹һ飬һӦԽķ
+    if (bin.Count >= 2 * BatchSize(index))
+      GetDepot().Return(index, bin.Split(BatchSize(index)));
+  }
+
+  /// @brief:ÿ̻߳Depot֮˵ڴ
+  static size_t BatchSize(size_t Index) {
+    return std::min<size_t>(
+        64, std::max<size_t>(4, 8192 / Pool::ClassSize(Index)));
+  }
+
+private:
+  struct FreeBlock {
+    FreeBlock *Next;
+  };
+
+  /// @brief:һͨNextڴ
+  struct Magazine {
+    FreeBlock *Head = nullptr;
+    size_t Count = 0;
+  };
+
+  /// @brief:̱߳صĳߴȼĿ
+  struct Bin : Magazine {
+    /// @brief:ͷժCountڴ
+    Magazine Split(size_t Count) {
+      Magazine mag;
+      mag.Head = this->Head;
+      FreeBlock *tail = this->Head;
+      for (size_t i = 1; i < Count; ++i)
+        tail = tail->Next;
+      this->Head = tail->Next;
+      tail->Next = nullptr;
+      mag.Count = Count;
+      this->Count -= Count;
+      return mag;
+    }
+  };
+
+  struct ThreadCache {
+    Bin Bins[NumClasses];
+
+    /// @brief:߳˳ʱڴȫ黹Depot
+    ~ThreadCache() {
+      for (size_t i = 0; i < NumClasses; ++i) {
+        if (Bins[i].Count)
+          GetDepot().Return(i, Bins[i].Split(Bins[i].Count));
+      }
+    }
+  };
+
+  /// @brief:̹߳ڴֿ
+  class Depot {
+  public:
+    /// @brief:ȡһڴ飬ֿΪʱPoolзµһ
+    Magazine Fetch(size_t Index) {
+      Shelf &shelf = shelves_[Index];
+      {
+        std::lock_guard<std::mutex> guard(shelf.Lock);
+        if (!shelf.Full.empty()) {
+          Magazine mag = shelf.Full.back();
+          shelf.Full.pop_back();
+          return mag;
+        }
+      }
+
+      Magazine mag;
+      size_t block_size = Pool::ClassSize(Index);
+      std::lock_guard<std::mutex> guard(pool_lock_);
+      for (size_t i = 0; i < BatchSize(Index); ++i) {
+        FreeBlock *block = (FreeBlock *)pool_.Allocate(block_size);
+        block->Next = mag.Head;
+        mag.Head = block;
+      }
+      mag.Count = BatchSize(Index);
+      return mag;
+    }
+
+    /// @brief:黹һڴ
+    void Return(size_t Index, const Magazine &Mag) {
+      Shelf &shelf = shelves_[Index];
+      std::lock_guard<std::mutex> guard(shelf.Lock);
+      shelf.Full.push_back(Mag);
+    }
+
+  private:
+    struct Shelf {
+      std::mutex Lock;
+      std::vector<Magazine> Full;
+    };
+
+    Shelf shelves_[NumClasses];
+    std::mutex pool_lock_;
+    Pool pool_;
+  };
+
+  static ThreadCache &GetThreadCache() {
+    thread_local ThreadCache cache;
+    return cache;
+  }
+
+  /// @brief:Depot˳ʱ̻߳黹Ķ
+  static Depot &GetDepot() {
+    static Depot *depot = new Depot();
+    return *depot;
+  }
+};
+
+} // namespace adt
\ No newline at end of file
@@ -0,0 +1,155 @@
+/**
+ * TrackingAllocator: ͳƷΪķװ
+ * תInnerͬʱAllocationStatsм¼ôֽ
+ * ǰռáֵԼ2ݷͰĳߴֱͼdumpΪJSON
+ * ͬTagʹòͬȫͳƣҲڹʱָͳƶ
+ **/
+#pragma once
+
+#include "Allocator.h"
+#include <atomic>
+#include <ostream>
+
+namespace adt {
+
+class AllocationStats {
+public:
+  /// iͰͳƳߴ(2^(i-1), 2^i]֮󣬵0ͰͳƳߴΪ01
+  static constexpr size_t NumBuckets = 48;
+
+public:
+  AllocationStats() { reset(); }
+
+  AllocationStats(const AllocationStats &) = delete;
+  AllocationStats &operator=(const AllocationStats &) = delete;
+
+  void RecordAllocate(size_t Size) {
+    allocations_.fetch_add(1, std::memory_order_relaxed);
+    bytes_allocated_.fetch_add(Size, std::memory_order_relaxed);
+    histogram_[BucketIndex(Size)].fetch_add(1, std::memory_order_relaxed);
+    size_t live =
+        live_bytes_.fetch_add(Size, std::memory_order_relaxed) + Size;
+    size_t peak = peak_bytes_.load(std::memory_order_relaxed);
+    while (live > peak && !peak_bytes_.compare_exchange_weak(
+                              peak, live, std::memory_order_relaxed))
+      ;
+  }
+
+  void RecordDeallocate(size_t Size) {
+    deallocations_.fetch_add(1, std::memory_order_relaxed);
+    bytes_freed_.fetch_add(Size, std::memory_order_relaxed);
+    live_bytes_.fetch_sub(Size, std::memory_order_relaxed);
+  }
+
+  size_t allocations() const { return allocations_.load(); }
+  size_t deallocations() const { return deallocations_.load(); }
+  size_t bytes_allocated() const { return bytes_allocated_.load(); }
+  size_t bytes_freed() const { return bytes_freed_.load(); }
+  size_t live_bytes() const { return live_bytes_.load(); }
+  size_t peak_bytes() const { return peak_bytes_.load(); }
+  size_t histogram(size_t Bucket) const { return histogram_[Bucket].load(); }
+
+  /// @brief:ͳ
+  void reset() {
+    allocations_ = 0;
+    deallocations_ = 0;
+    bytes_allocated_ = 0;
+    bytes_freed_ = 0;
+    live_bytes_ = 0;
+    peak_bytes_ = 0;
+    for (size_t i = 0; i < NumBuckets; ++i)
+      histogram_[i] = 0;
+  }
+
+  /// @brief:һJSONͳƽֱͼֻǿյͰ
+  void dump(std::ostream &OS, const char *Name = "") const {
+    OS << "{\"name\":\"" << Name << "\""
+       << ",\"allocations\":" << allocations()
+       << ",\"deallocations\":" << deallocations()
+       << ",\"bytes_allocated\":" << bytes_allocated()
+       << ",\"bytes_freed\":" << bytes_freed()
+       << ",\"live_bytes\":" << live_bytes()
+       << ",\"peak_bytes\":" << peak_bytes() << ",\"histogram\":[";
+    bool first = true;
+    for (size_t i = 0; i < NumBuckets; ++i) {
+      size_t count = histogram(i);
+      if (!count)
+        continue;
+      OS << (first ? "" : ",") << "{\"le\":" << (1ULL << i)
+         << ",\"count\":" << count << "}";
+      first = false;
+    }
+    OS << "]}" << std::endl;
+  }
+
+  /// @brief:ȡSizeֱͼͰ
+  static size_t BucketIndex(size_t Size) {
+    size_t index = 0;
+    while (index + 1 < NumBuckets && (1ULL << index) < Size)
+      ++index;
+    return index;
+  }
+
+private:
+  std::atomic<size_t> allocations_;
+  std::atomic<size_t> deallocations_;
+  std::atomic<size_t> bytes_allocated_;
+  std::atomic<size_t> bytes_freed_;
+  std::atomic<size_t> live_bytes_;
+  std::atomic<size_t> peak_bytes_;
+  std::atomic<size_t> histogram_[NumBuckets];
+};
+
+template <typename Inner = Allocator, typename Tag = void>
+class TrackingAllocator : private AllocatorHolder<Inner> {
+public:
+  using holder_ = AllocatorHolder<Inner>;
+
+public:
+  TrackingAllocator() : stats_(&GlobalStats()) {}
+
+  explicit TrackingAllocator(AllocationStats *Stats,
+                             const Inner &Al = Inner())
+      : holder_(Al), stats_(Stats) {}
+
+  char *Allocate(size_t Size) {
+    stats_->RecordAllocate(Size);
+    return this->GetAllocator().Allocate(Size);
+  }
+
+  char *Allocate(size_t Size, size_t Alignment) {
+    stats_->RecordAllocate(Size);
+    return AllocatorTraits<Inner>::Allocate(this->GetAllocator(), Size,
+                                            Alignment);
+  }
+
+  void Deallocate(void *Buffer, size_t Size) {
+    if (!Buffer)
+      return;
+    stats_->RecordDeallocate(Size);
+    this->GetAllocator().Deallocate(Buffer, Size);
+  }
+
+  void Deallocate(void *Buffer, size_t Size, size_t Alignment) {
+    if (!Buffer)
+      return;
+    stats_->RecordDeallocate(Size);
+    AllocatorTraits<Inner>::Deallocate(this->GetAllocator(), Buffer, Size,
+                                       Alignment);
+  }
+
+  AllocationStats &stats() const { return *stats_; }
+
+  Inner inner() const { return this->GetAllocator(); }
+
+  /// @brief:ĬϹTrackingAllocatorͳƣÿTagһ
+  static AllocationStats &GlobalStats() {
+    static AllocationStats stats;
+    return stats;
+  }
+
+private:
+  AllocationStats *stats_;
+};
+
+} // namespace adt
\ No newline at end of file
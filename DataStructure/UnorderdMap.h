@@ -27,6 +27,13 @@ public:
   using iterator = HashIterator<BucketTy>;
   using const_iterator = const HashIterator<BucketTy>;
   using hash_entry = HashEntry<BucketTy>;
+  using base_ =
+      DenseHash<BucketTy, UnorderedMapBucketTraits<BucketTy>, AllocatorTy>;
+
+public:
+  UnorderedMap() {}
+
+  explicit UnorderedMap(const AllocatorTy &Al) : base_(Al) {}
 
   ValTy &operator[](const KeyTy &Key) {
     hash_entry *place = this->LookupHashEntry(Key);
@@ -16,16 +16,19 @@ class UnorderedSet
 public:
   using iterator = HashIterator<Ty>;
   using const_iterator = const HashIterator<Ty>;
+  using base_ = DenseHash<Ty, UnorderedSetBucketTraits<Ty>, AllocatorTy>;
 
 public:
   UnorderedSet() {}
 
+  explicit UnorderedSet(const AllocatorTy &Al) : base_(Al) {}
+
   template <typename Iterator> UnorderedSet(Iterator First, Iterator Last) {
     for (Iterator it = First; it != Last; ++it)
       this->insert(*it);
   }
 
-  UnorderedSet(const UnorderedSet &Right) {
+  UnorderedSet(const UnorderedSet &Right) : base_(Right.get_allocator()) {
     for (iterator it = Right.begin(); it != Right.end(); ++it)
       this->insert(*it);
   }
@@ -0,0 +1,442 @@
+/**
+ * UnrolledList: չ
+ * ÿ㱣KԪأ֮Ȼ˫
+ * ListÿԪһ㣬ָĿ̯KԪϣ
+ * ʱ󲿷ʱڽڲǰʽӽ顣
+ * ʱ԰֣ɾԪع̽ϲ
+ * ڵɾֻᶯڵԪأȻO(K)=O(1)
+ * ɾʹͬһеĵʧЧ
+ * Listһ£emplace/insertԪز뵽Where֮
+ * 
+ *	push_back/push_front		β/ͷԪ
+ *	pop_back/pop_front			β/ͷԪ
+ *	emplace/insert				Where֮Ԫ
+ *	remove						ƳWhereԪػеValԪ
+ **/
+#pragma once
+
+#include "Allocator.h"
+#include <assert.h>
+#include <initializer_list>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <string.h>
+#include <type_traits>
+
+namespace adt {
+
+template <typename Ty> struct UnrolledListLink {
+  UnrolledListLink *Prev = nullptr;
+  UnrolledListLink *Next = nullptr;
+  size_t Count = 0;
+};
+
+template <typename Ty, size_t K>
+struct UnrolledListNode : UnrolledListLink<Ty> {
+  alignas(Ty) unsigned char Storage[K * sizeof(Ty)];
+
+  Ty *Data() { return (Ty *)Storage; }
+};
+
+template <typename Ty, size_t K, bool IsConst> class UnrolledListIterator {
+public:
+  using link_ptr = UnrolledListLink<Ty> *;
+  using node_ptr = UnrolledListNode<Ty, K> *;
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = Ty;
+  using pointer = std::conditional_t<IsConst, const Ty *, Ty *>;
+  using reference = std::conditional_t<IsConst, const Ty &, Ty &>;
+  using difference_type = ptrdiff_t;
+
+public:
+  UnrolledListIterator() : node_(nullptr), index_(0) {}
+
+  UnrolledListIterator(link_ptr Node, size_t Index)
+      : node_(Node), index_(Index) {}
+
+  /// @brief:ǳתΪ
+  template <bool OtherConst,
+            typename = std::enable_if_t<IsConst && !OtherConst>>
+  UnrolledListIterator(const UnrolledListIterator<Ty, K, OtherConst> &Another)
+      : node_(Another.node()), index_(Another.index()) {}
+
+  UnrolledListIterator &operator++() {
+    if (++index_ == node_->Count) {
+      node_ = node_->Next;
+      index_ = 0;
+    }
+    return *this;
+  }
+
+  UnrolledListIterator &operator--() {
+    if (index_ == 0) {
+      node_ = node_->Prev;
+      index_ = node_->Count;
+    }
+    --index_;
+    return *this;
+  }
+
+  const UnrolledListIterator operator++(int) {
+    UnrolledListIterator it = *this;
+    ++*this;
+    return it;
+  }
+
+  const UnrolledListIterator operator--(int) {
+    UnrolledListIterator it = *this;
+    --*this;
+    return it;
+  }
+
+  reference operator*() const { return ((node_ptr)node_)->Data()[index_]; }
+
+  pointer operator->() const { return &**this; }
+
+  bool operator==(const UnrolledListIterator &Another) const {
+    return node_ == Another.node_ && index_ == Another.index_;
+  }
+
+  bool operator!=(const UnrolledListIterator &Another) const {
+    return !(*this == Another);
+  }
+
+  link_ptr node() const { return node_; }
+  size_t index() const { return index_; }
+
+private:
+  link_ptr node_;
+  size_t index_;
+};
+
+template <typename Ty, size_t K = 16, typename AllocatorTy = Allocator>
+class UnrolledList : private AllocatorHolder<AllocatorTy> {
+  static_assert(K >= 2, "a node must hold at least 2 elements");
+
+public:
+  using link = UnrolledListLink<Ty>;
+  using link_ptr = UnrolledListLink<Ty> *;
+  using node = UnrolledListNode<Ty, K>;
+  using node_ptr = UnrolledListNode<Ty, K> *;
+  using reference = Ty &;
+  using const_reference = const Ty &;
+  using value_type = Ty;
+  using iterator = UnrolledListIterator<Ty, K, false>;
+  using const_iterator = UnrolledListIterator<Ty, K, true>;
+
+  using al_ = AllocatorTy;
+  using holder_ = AllocatorHolder<AllocatorTy>;
+
+public:
+  UnrolledList() { head_.Next = head_.Prev = &head_; }
+
+  explicit UnrolledList(const AllocatorTy &Al) : holder_(Al) {
+    head_.Next = head_.Prev = &head_;
+  }
+
+  UnrolledList(std::initializer_list<Ty> Init,
+               const AllocatorTy &Al = AllocatorTy())
+      : holder_(Al) {
+    head_.Next = head_.Prev = &head_;
+    for (const Ty &element : Init)
+      emplace_back(element);
+  }
+
+  UnrolledList(const UnrolledList &Another) : holder_(Another.GetAllocator()) {
+    head_.Next = head_.Prev = &head_;
+    for (const_iterator it = Another.begin(); it != Another.end(); ++it)
+      emplace_back(*it);
+  }
+
+  UnrolledList(UnrolledList &&Another)
+      : holder_(std::move(Another.GetAllocator())) {
+    head_.Next = head_.Prev = &head_;
+    Steal(Another);
+  }
+
+  ~UnrolledList() { clear(); }
+
+  UnrolledList &operator=(const UnrolledList &Right) {
+    if (this == &Right)
+      return *this;
+    clear();
+    for (const_iterator it = Right.begin(); it != Right.end(); ++it)
+      emplace_back(*it);
+    return *this;
+  }
+
+  UnrolledList &operator=(UnrolledList &&Right) {
+    if (this == &Right)
+      return *this;
+    clear();
+    this->GetAllocator() = std::move(Right.GetAllocator());
+    Steal(Right);
+    return *this;
+  }
+
+  void push_back(const_reference Element) { emplace_back(Element); }
+  void push_back(Ty &&Element) { emplace_back(std::move(Element)); }
+  void push_front(const_reference Element) { emplace_front(Element); }
+  void push_front(Ty &&Element) { emplace_front(std::move(Element)); }
+
+  template <typename... ValTy> void emplace_back(ValTy &&... Element) {
+    link_ptr tail = head_.Prev;
+    if (tail == &head_ || tail->Count == K)
+      tail = NewNode(tail);
+    ::new (AsNode(tail)->Data() + tail->Count)
+        Ty(std::forward<ValTy>(Element)...);
+    ++tail->Count;
+    ++size_;
+  }
+
+  template <typename... ValTy> void emplace_front(ValTy &&... Element) {
+    InsertAt(head_.Next, 0, std::forward<ValTy>(Element)...);
+  }
+
+  /// @brief:Where֮ԪأWhereΪend()ʱ뵽ͷ
+  template <typename... ValTy>
+  iterator emplace(iterator Where, ValTy &&... Element) {
+    if (Where.node() == &head_)
+      return InsertAt(head_.Next, 0, std::forward<ValTy>(Element)...);
+    return InsertAt(Where.node(), Where.index() + 1,
+                    std::forward<ValTy>(Element)...);
+  }
+
+  iterator insert(iterator Where, const Ty &Val) { return emplace(Where, Val); }
+
+  iterator insert(iterator Where, size_t Count, const Ty &Val) {
+    iterator cur = Where;
+    for (size_t i = 0; i < Count; ++i)
+      cur = emplace(cur, Val);
+    return cur;
+  }
+
+  template <typename Iterator>
+  void insert(iterator Where, Iterator First, Iterator Last) {
+    iterator cur = Where;
+    for (Iterator it = First; it != Last; ++it)
+      cur = emplace(cur, *it);
+  }
+
+  void insert(iterator Where, std::initializer_list<Ty> Init) {
+    insert(Where, Init.begin(), Init.end());
+  }
+
+  /// @brief:ƳWhereԪأһԪ
+  iterator remove(iterator Where) {
+    assert(Where.node() != &head_);
+    return RemoveAt(Where.node(), Where.index());
+  }
+
+  /// @brief:ƳеValԪ
+  void remove(const Ty &Val) {
+    iterator it = begin();
+    while (it != end()) {
+      if (*it == Val)
+        it = remove(it);
+      else
+        ++it;
+    }
+  }
+
+  void pop_front() {
+    assert(size_ > 0);
+    RemoveAt(head_.Next, 0);
+  }
+
+  void pop_back() {
+    assert(size_ > 0);
+    RemoveAt(head_.Prev, head_.Prev->Count - 1);
+  }
+
+  reference front() {
+    assert(size_ > 0);
+    return AsNode(head_.Next)->Data()[0];
+  }
+
+  const_reference front() const {
+    assert(size_ > 0);
+    return AsNode(head_.Next)->Data()[0];
+  }
+
+  reference back() {
+    assert(size_ > 0);
+    return AsNode(head_.Prev)->Data()[head_.Prev->Count - 1];
+  }
+
+  const_reference back() const {
+    assert(size_ > 0);
+    return AsNode(head_.Prev)->Data()[head_.Prev->Count - 1];
+  }
+
+  iterator begin() { return iterator(head_.Next, 0); }
+  iterator end() { return iterator(&head_, 0); }
+  const_iterator begin() const { return const_iterator(head_.Next, 0); }
+  const_iterator end() const { return const_iterator(GetHead(), 0); }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+  /// @brief:Ԫزͷн
+  void clear() {
+    link_ptr cur = head_.Next;
+    while (cur != &head_) {
+      link_ptr next = cur->Next;
+      std::destroy(AsNode(cur)->Data(), AsNode(cur)->Data() + cur->Count);
+      DeleteNode(cur);
+      cur = next;
+    }
+    head_.Next = head_.Prev = &head_;
+    size_ = 0;
+  }
+
+  size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+
+  al_ get_allocator() const { return this->GetAllocator(); }
+
+  void dump() {
+    std::cout << "[";
+    for (iterator it = begin(); it != end(); ++it)
+      std::cout << *it << ",";
+    std::cout << "]" << std::endl;
+  }
+
+private:
+  static node_ptr AsNode(link_ptr Link) { return (node_ptr)Link; }
+
+  link_ptr GetHead() const { return (link_ptr)&head_; }
+
+  /// @brief:After֮󴴽һս
+  link_ptr NewNode(link_ptr After) {
+    node_ptr new_node = (node_ptr)AllocatorTraits<al_>::Allocate(
+        this->GetAllocator(), sizeof(node), alignof(node));
+    ::new (new_node) node();
+    new_node->Prev = After;
+    new_node->Next = After->Next;
+    After->Next->Prev = new_node;
+    After->Next = new_node;
+    return new_node;
+  }
+
+  /// @brief:ƳͷţеԪҪ
+  void DeleteNode(link_ptr Node) {
+    Node->Prev->Next = Node->Next;
+    Node->Next->Prev = Node->Prev;
+    std::destroy_at(AsNode(Node));
+    AllocatorTraits<al_>::Deallocate(this->GetAllocator(), Node, sizeof(node),
+                                     alignof(node));
+  }
+
+  /// @brief:[First,Last)ᵽδʼDestDest(First,Last)֮
+  static void MoveForward(Ty *First, Ty *Last, Ty *Dest) {
+    if constexpr (std::is_trivially_copyable<Ty>::value) {
+      memmove((void *)Dest, (const void *)First, (Last - First) * sizeof(Ty));
+    } else {
+      for (; First != Last; ++First, ++Dest) {
+        ::new (Dest) Ty(std::move(*First));
+        std::destroy_at(First);
+      }
+    }
+  }
+
+  /// @brief:[First,Last)ᶯһλ
+  static void ShiftRight(Ty *First, Ty *Last) {
+    if constexpr (std::is_trivially_copyable<Ty>::value) {
+      memmove((void *)(First + 1), (const void *)First,
+              (Last - First) * sizeof(Ty));
+    } else {
+      for (Ty *it = Last; it != First; --it) {
+        ::new (it) Ty(std::move(it[-1]));
+        std::destroy_at(it - 1);
+      }
+    }
+  }
+
+  /// @brief:ڽNodeĵPosλòԪأʱȶ԰
+  template <typename... ValTy>
+  iterator InsertAt(link_ptr Node, size_t Pos, ValTy &&... Element) {
+    if (Node == &head_) {
+      /// 
+      Node = NewNode(&head_);
+      Pos = 0;
+    }
+    if (Node->Count == K) {
+      /// ԪزýҪᶯԪأȹʱ
+      Ty element(std::forward<ValTy>(Element)...);
+      link_ptr half = NewNode(Node);
+      size_t keep = K / 2;
+      MoveForward(AsNode(Node)->Data() + keep, AsNode(Node)->Data() + K,
+                  AsNode(half)->Data());
+      half->Count = K - keep;
+      Node->Count = keep;
+      if (Pos > keep) {
+        Node = half;
+        Pos -= keep;
+      }
+      return ConstructAt(Node, Pos, std::move(element));
+    }
+    return ConstructAt(Node, Pos, std::forward<ValTy>(Element)...);
+  }
+
+  template <typename... ValTy>
+  iterator ConstructAt(link_ptr Node, size_t Pos, ValTy &&... Element) {
+    Ty *data = AsNode(Node)->Data();
+    if (Pos == Node->Count) {
+      ::new (data + Pos) Ty(std::forward<ValTy>(Element)...);
+    } else {
+      Ty element(std::forward<ValTy>(Element)...);
+      ShiftRight(data + Pos, data + Node->Count);
+      ::new (data + Pos) Ty(std::move(element));
+    }
+    ++Node->Count;
+    ++size_;
+    return iterator(Node, Pos);
+  }
+
+  /// @brief:ƳNodeĵPosԪأһԪ
+  /// ΪʱͷţԪK/4̽Ԫطŵýһʱϲ
+  iterator RemoveAt(link_ptr Node, size_t Pos) {
+    Ty *data = AsNode(Node)->Data();
+    std::destroy_at(data + Pos);
+    MoveForward(data + Pos + 1, data + Node->Count, data + Pos);
+    --Node->Count;
+    --size_;
+
+    if (Node->Count == 0) {
+      link_ptr next = Node->Next;
+      DeleteNode(Node);
+      return iterator(next, 0);
+    }
+    link_ptr next = Node->Next;
+    if (Node->Count < K / 4 && next != &head_ &&
+        Node->Count + next->Count <= K) {
+      MoveForward(AsNode(next)->Data(), AsNode(next)->Data() + next->Count,
+                  data + Node->Count);
+      Node->Count += next->Count;
+      DeleteNode(next);
+    }
+    if (Pos == Node->Count)
+      return iterator(Node->Next, 0);
+    return iterator(Node, Pos);
+  }
+
+  /// @brief:ӹAnotherн
+  void Steal(UnrolledList &Another) {
+    if (Another.head_.Next == &Another.head_)
+      return;
+    head_.Next = Another.head_.Next;
+    head_.Prev = Another.head_.Prev;
+    head_.Next->Prev = &head_;
+    head_.Prev->Next = &head_;
+    size_ = Another.size_;
+    Another.head_.Next = Another.head_.Prev = &Another.head_;
+    Another.size_ = 0;
+  }
+
+private:
+  link head_;
+  size_t size_ = 0;
+};
+
+} // namespace adt
\ No newline at end of file
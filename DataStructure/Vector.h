@@ -8,20 +8,84 @@
  *	append			׷[First,End)ΧڵԪ
  *	append			׷CountElementĸ
  *	assign			[First,End)ֵǰ
+ *	insert			ָλ֮ǰһԪءCountƻ[First,Last)Ԫ
+ *	emplace			ָλ֮ǰԭعԪ
+ *	erase			ƳһԪػ[First,Last)ΧڵԪ
+ *	reserve			֤Сֵָ
+ *	shrink_to_fit	ǰС
+ * չGrowthTyڱָѡ
+ *	DefaultGrowth			С512Ԫʱ֮ÿ64
+ *	GeometricGrowth<N,D>	N/Dչ
+ *	PageGrowth<PageSize>	չֽȡҳʺMmapAllocator
+ *	FixedGrowth<Increment>	ÿӹ̶Ԫظ
  **/
 #pragma once
 
 #include "Allocator.h"
+#include "Basis.h"
 #include <assert.h>
+#include <functional>
 #include <initializer_list>
 #include <iostream>
 #include <memory>
+#include <string.h>
+#include <type_traits>
 
 namespace adt {
 
-class Allocator;
+/// @brief:Ĭչ
+/// ÿṩNewCapacity(Capacity, Required, ElementSize)
+/// زСRequired
+struct DefaultGrowth {
+  static size_t NewCapacity(size_t Capacity, size_t Required, size_t) {
+    size_t new_cap = Capacity < 512 ? Capacity * 2 : Capacity + 64;
+    if (new_cap < Required)
+      new_cap = (Required + 0x40) & (~(size_t)0x3F);
+    return new_cap < 16 ? 16 : new_cap;
+  }
+};
+
+/// @brief:Num/Denչ
+template <size_t Num = 3, size_t Den = 2> struct GeometricGrowth {
+  static_assert(Num > Den, "growth factor must be greater than 1");
+
+  static size_t NewCapacity(size_t Capacity, size_t Required, size_t) {
+    size_t new_cap = Capacity * Num / Den;
+    if (new_cap <= Capacity)
+      new_cap = Capacity + 1;
+    if (new_cap < Required)
+      new_cap = Required;
+    return new_cap < 4 ? 4 : new_cap;
+  }
+};
+
+/// @brief:󽫻ֽȡPageSize
+template <size_t PageSize = 4096> struct PageGrowth {
+  static_assert((PageSize & (PageSize - 1)) == 0,
+                "page size must be a power of 2");
+
+  static size_t NewCapacity(size_t Capacity, size_t Required,
+                            size_t ElementSize) {
+    size_t new_cap = Capacity * 2 < Required ? Required : Capacity * 2;
+    size_t bytes = (new_cap * ElementSize + PageSize - 1) & ~(PageSize - 1);
+    return bytes / ElementSize;
+  }
+};
+
+/// @brief:ÿIncrementԪ
+template <size_t Increment = 64> struct FixedGrowth {
+  static_assert(Increment > 0, "increment must be positive");
+
+  static size_t NewCapacity(size_t Capacity, size_t Required, size_t) {
+    size_t steps =
+        Required > Capacity ? (Required - Capacity + Increment - 1) / Increment
+                            : 1;
+    return Capacity + steps * Increment;
+  }
+};
 
-template <typename Ty> class VectorBase {
+/// @brief:Ĺ֣DerivedҪṩgrow(Size)֤СSize
+template <typename Ty, typename Derived> class VectorBase {
 public:
   using iterator = Ty *;
   using const_iterator = const Ty *;
@@ -70,36 +134,97 @@ public:
   }
 
   /// @brief:ƳItԪ
-  iterator erase(iterator It) {
-    iterator it = It;
-    for (iterator iter = It + 1; iter != this->end(); ++iter, ++it) {
-      std::destroy_at(it);
-      ::new (std::addressof(*it)) Ty(std::move(*iter));
+  iterator erase(const_iterator It) { return erase(It, It + 1); }
+
+  /// @brief:Ƴ[First,Last)ΧڵԪأԪֻᶯһ
+  /// @return ƳĵһԪ֮Ԫ
+  iterator erase(const_iterator First, const_iterator Last) {
+    iterator first = const_cast<iterator>(First);
+    iterator last = const_cast<iterator>(Last);
+    size_t count = last - first;
+    if (count == 0)
+      return first;
+    if constexpr (std::is_trivially_copyable<Ty>::value) {
+      memmove((void *)first, (const void *)last,
+              (this->end() - last) * sizeof(Ty));
+    } else {
+      std::move(last, this->end(), first);
+      std::destroy(this->end() - count, this->end());
     }
-    pop_back();
-    return const_cast<iterator>(It);
+    this->size_ -= count;
+    return first;
   }
 
-  /// @brief:
-  void push_back(const Ty &Element) {
-    if (this->size() >= this->capacity())
-      grow();
-    ::new (this->end()) Ty(Element);
-    ++this->size_;
+  /// @brief:Pos֮ǰValue
+  iterator insert(const_iterator Pos, const Ty &Value) {
+    return emplace(Pos, Value);
   }
 
-  /// @brief:ʱ
-  void push_back(Ty &&Element) {
-    if (this->size() >= this->capacity())
-      grow();
-    ::new (this->end()) Ty(std::move(Element));
+  /// @brief:Pos֮ǰʱ
+  iterator insert(const_iterator Pos, Ty &&Value) {
+    return emplace(Pos, std::move(Value));
+  }
+
+  /// @brief:Pos֮ǰCountValueĸ
+  /// @return ĵһԪ
+  iterator insert(const_iterator Pos, size_t Count, const Ty &Value) {
+    /// ValueǵǰеԪأȸһƶԪ
+    Ty copy(Value);
+    iterator gap = OpenGap(Pos - this->begin(), Count);
+    std::uninitialized_fill_n(gap, Count, copy);
+    this->size_ += Count;
+    return gap;
+  }
+
+  /// @brief:Pos֮ǰ[First,Last)Ԫأ[First,Last)ڵǰ
+  /// @return ĵһԪ
+  template <typename Iterator,
+            typename = std::enable_if_t<!std::is_integral<Iterator>::value>>
+  iterator insert(const_iterator Pos, Iterator First, Iterator Last) {
+    size_t count = std::distance(First, Last);
+    iterator gap = OpenGap(Pos - this->begin(), count);
+    std::uninitialized_copy(First, Last, gap);
+    this->size_ += count;
+    return gap;
+  }
+
+  /// @brief:Pos֮ǰʼб
+  iterator insert(const_iterator Pos, std::initializer_list<Ty> InitList) {
+    return insert(Pos, InitList.begin(), InitList.end());
+  }
+
+  /// @brief:Pos֮ǰԭعԪ
+  /// @return Ԫ
+  template <typename... ValTy>
+  iterator emplace(const_iterator Pos, ValTy &&... Value) {
+    size_t index = Pos - this->begin();
+    if (index == this->size()) {
+      emplace_back(std::forward<ValTy>(Value)...);
+      return this->end() - 1;
+    }
+    /// õǰеԪأȹƶԪ
+    Ty element(std::forward<ValTy>(Value)...);
+    iterator gap = OpenGap(index, 1);
+    ::new (gap) Ty(std::move(element));
     ++this->size_;
+    return gap;
   }
 
+  /// @brief:
+  void push_back(const Ty &Element) { emplace_back(Element); }
+
+  /// @brief:ʱ
+  void push_back(Ty &&Element) { emplace_back(std::move(Element)); }
+
   template <typename... ValTy> void emplace_back(ValTy &&... Value) {
-    if (this->size() >= this->capacity())
-      grow();
-    ::new (this->end()) Ty(std::forward<ValTy>(Value)...);
+    if (this->size() < this->capacity()) {
+      ::new (this->end()) Ty(std::forward<ValTy>(Value)...);
+    } else {
+      /// õǰеԪأչͷžɻȹչ
+      Ty element(std::forward<ValTy>(Value)...);
+      Self()->grow(this->size() + 1);
+      ::new (this->end()) Ty(std::move(element));
+    }
     this->size_++;
   }
 
@@ -110,19 +235,39 @@ public:
   }
 
   /// @brief:[First,Last)Ԫӵvector
+  /// [First,Last)ǵǰеԪأչ±¶λ
   template <typename Iterator> void append(Iterator First, Iterator Last) {
     size_t append_count = std::distance(First, Last);
-    if (this->capacity() - this->size() < append_count)
-      grow(this->size() + append_count);
+    if (this->capacity() - this->size() < append_count) {
+      constexpr bool may_alias =
+          std::is_pointer<Iterator>::value &&
+          std::is_same<std::remove_cv_t<std::remove_pointer_t<Iterator>>,
+                       Ty>::value;
+      size_t index = this->size_;
+      if constexpr (may_alias)
+        index = Owns(First) ? First - this->data_ : index;
+      Self()->grow(this->size() + append_count);
+      if constexpr (may_alias) {
+        if (index < this->size_) {
+          First = this->data_ + index;
+          Last = First + append_count;
+        }
+      }
+    }
     std::uninitialized_copy(First, Last, this->end());
     this->size_ += append_count;
   }
 
   /// @brief:ElementCount
   void append(size_t Count, const Ty &Element) {
-    if (this->capacity() - this->size() < Count)
-      grow(this->size() + Count);
-    std::uninitialized_fill_n(this->end(), Count, Element);
+    if (this->capacity() - this->size() >= Count) {
+      std::uninitialized_fill_n(this->end(), Count, Element);
+    } else {
+      /// ElementǵǰеԪأȸһչ
+      Ty copy(Element);
+      Self()->grow(this->size() + Count);
+      std::uninitialized_fill_n(this->end(), Count, copy);
+    }
     this->size_ += Count;
   }
 
@@ -140,20 +285,16 @@ public:
 
   /// @brief:С
   void resize(size_t NewSize, const Ty &Val) {
-    int diff = NewSize - size_;
-    if (diff == 0)
-      return;
-    else if (diff > 0) {
-      this->grow(NewSize);
-      std::uninitialized_fill_n(end(), diff, Val);
-      size_ = NewSize;
+    if (NewSize > size_) {
+      append(NewSize - size_, Val);
     } else {
       std::destroy(begin() + NewSize, begin() + size());
       size_ = NewSize;
     }
   }
 
-  void reserve(size_t NewCapacity) { this->grow(NewCapacity); }
+  /// @brief:֤СNewCapacity
+  void reserve(size_t NewCapacity) { Self()->grow(NewCapacity); }
 
   /// @brief:С
   void resize(size_t NewSize) { resize(NewSize, Ty()); }
@@ -167,7 +308,36 @@ public:
   }
 
 protected:
-  virtual void grow(size_t Size = 0) = 0;
+  Derived *Self() { return static_cast<Derived *>(this); }
+
+  /// @brief:PtrǷָǰеԪ
+  bool Owns(const Ty *Ptr) const {
+    std::less<const Ty *> less;
+    return !less(Ptr, data_) && less(Ptr, data_ + size_);
+  }
+
+  /// @brief:Index֮ԪᶯCountλãճδʼ
+  /// @note:size_䣬ɵճ
+  iterator OpenGap(size_t Index, size_t Count) {
+    assert(Index <= size_);
+    if (capacity_ - size_ < Count)
+      Self()->grow(size_ + Count);
+    iterator gap = data_ + Index;
+    if (Count == 0 || Index == size_)
+      return gap;
+    if constexpr (std::is_trivially_copyable<Ty>::value) {
+      memmove((void *)(gap + Count), (const void *)gap,
+              (size_ - Index) * sizeof(Ty));
+    } else {
+      /// βʼᵽCountλ֮ԭλΪδʼĿռ
+      for (iterator it = this->end(); it != gap;) {
+        --it;
+        ::new (it + Count) Ty(std::move(*it));
+        std::destroy_at(it);
+      }
+    }
+    return gap;
+  }
 
 protected:
   pointer data_ = nullptr;
@@ -175,51 +345,85 @@ protected:
   size_t capacity_ = 0;
 };
 
-template <typename Ty, typename AllocatorTy = Allocator>
-class Vector : public VectorBase<Ty> {
+template <typename Ty, typename AllocatorTy = Allocator,
+          typename GrowthTy = DefaultGrowth>
+class Vector : public VectorBase<Ty, Vector<Ty, AllocatorTy, GrowthTy>>,
+               private AllocatorHolder<AllocatorTy> {
+  friend class VectorBase<Ty, Vector>;
+
 public:
   using al_ = AllocatorTy;
+  using holder_ = AllocatorHolder<AllocatorTy>;
 
 public:
   explicit Vector() {
-    this->data_ = (Ty *)al_::Allocate(16 * sizeof(Ty));
+    this->data_ = AllocateBuffer(16);
+    this->capacity_ = 16;
+  }
+
+  explicit Vector(const AllocatorTy &Al) : holder_(Al) {
+    this->data_ = AllocateBuffer(16);
     this->capacity_ = 16;
   }
 
-  explicit Vector(size_t InitSize) {
-    this->data_ = (Ty *)al_::Allocate(InitSize * sizeof(Ty));
+  explicit Vector(size_t InitSize, const AllocatorTy &Al = AllocatorTy())
+      : holder_(Al) {
+    this->data_ = AllocateBuffer(InitSize);
     this->size_ = this->capacity_ = InitSize;
     /// ߱뱣֤BastTyӵĬϹ캯Ȼܵøù캯
     Ty temp;
     std::uninitialized_fill(this->begin(), this->end(), temp);
   }
 
-  explicit Vector(size_t InitSize, const Ty &Init) {
-    this->data_ = (Ty *)al_::Allocate(InitSize * sizeof(Ty));
+  explicit Vector(size_t InitSize, const Ty &Init,
+                  const AllocatorTy &Al = AllocatorTy())
+      : holder_(Al) {
+    this->data_ = AllocateBuffer(InitSize);
     this->size_ = this->capacity_ = InitSize;
     std::uninitialized_fill(this->begin(), this->end(), Init);
   }
 
-  explicit Vector(std::initializer_list<Ty> InitList) {
+  explicit Vector(std::initializer_list<Ty> InitList,
+                  const AllocatorTy &Al = AllocatorTy())
+      : holder_(Al) {
     this->size_ = this->capacity_ = InitList.size();
-    this->data_ = (Ty *)al_::Allocate(this->size_ * sizeof(Ty));
+    this->data_ = AllocateBuffer(this->size_);
     std::uninitialized_copy(InitList.begin(), InitList.end(), this->begin());
   }
 
-  explicit Vector(const Vector &Another) {
+  explicit Vector(const Vector &Another) : holder_(Another.GetAllocator()) {
     this->size_ = Another.size();
     this->capacity_ = Another.capacity();
-    this->data_ = (Ty *)al_::Allocate(this->capacity_ * sizeof(Ty));
+    this->data_ = AllocateBuffer(this->capacity_);
     std::uninitialized_copy(Another.begin(), Another.end(), this->begin());
   }
 
-  explicit Vector(Vector &&Another) {
-    this->data_ = Another.data();
-    this->size_ = Another.size();
-    this->capacity_ = Another.capacity();
+  explicit Vector(Vector &&Another)
+      : holder_(std::move(Another.GetAllocator())) {
+    this->data_ = Another.data_;
+    this->size_ = Another.size_;
+    this->capacity_ = Another.capacity_;
+    Another.data_ = nullptr;
+    Another.size_ = Another.capacity_ = 0;
+  }
+
+  ~Vector() {
+    std::destroy(this->begin(), this->end());
+    DeallocateBuffer(this->data_, this->capacity_);
   }
 
-  size_t reserve(size_t Size) { grow(Size); }
+  al_ get_allocator() const { return this->GetAllocator(); }
+
+  /// @brief:ǰС
+  void shrink_to_fit() {
+    if (this->size_ == this->capacity_)
+      return;
+    Ty *new_data = this->size_ ? AllocateBuffer(this->size_) : nullptr;
+    Relocate(this->begin(), this->end(), new_data);
+    DeallocateBuffer(this->data_, this->capacity_);
+    this->data_ = new_data;
+    this->capacity_ = this->size_;
+  }
 
   /// @brief:constýиֵ
   Vector &operator=(const Vector &Right) {
@@ -230,27 +434,44 @@ public:
 
   /// @brief:ֵýиֵ
   Vector &operator=(Vector &&Right) {
+    if (this == &Right)
+      return *this;
     this->clear();
-    this->data_ = Right.data();
-    this->size_ = Right.size();
-    this->capacity_ = Right.capacity();
+    DeallocateBuffer(this->data_, this->capacity_);
+    this->GetAllocator() = std::move(Right.GetAllocator());
+    this->data_ = Right.data_;
+    this->size_ = Right.size_;
+    this->capacity_ = Right.capacity_;
+    Right.data_ = nullptr;
+    Right.size_ = Right.capacity_ = 0;
     return *this;
   }
 
 private:
-  /// @brief:չԿռ
-  virtual void grow(size_t Size) {
-    size_t new_cap = Size;
-    if (this->capacity_ > Size)
+  /// @brief:CountԪصĻ
+  Ty *AllocateBuffer(size_t Count) {
+    return (Ty *)AllocatorTraits<al_>::AllocateBuffer(
+        this->GetAllocator(), Count * sizeof(Ty), alignof(Ty));
+  }
+
+  /// @brief:ͷAllocateBufferĻ
+  void DeallocateBuffer(Ty *Buffer, size_t Count) {
+    if (!Buffer)
       return;
-    if (Size == 0)
-      new_cap = this->size_ < 512 ? this->size_ * 2 : this->size_ + 64;
-    else
-      new_cap = (new_cap + 0x40) & (~(size_t)0x3F);
+    AllocatorTraits<al_>::DeallocateBuffer(
+        this->GetAllocator(), Buffer, Count * sizeof(Ty), alignof(Ty));
+  }
 
-    Ty *new_data = (Ty *)al_::Allocate(new_cap * sizeof(Ty));
-    std::uninitialized_copy(this->begin(), this->end(), new_data);
-    std::destroy(this->begin(), this->end());
+  /// @brief:չԿռ䣬֤СSize
+  void grow(size_t Size) {
+    if (this->capacity_ >= Size)
+      return;
+    size_t new_cap =
+        GrowthTy::NewCapacity(this->capacity_, Size, sizeof(Ty));
+
+    Ty *new_data = AllocateBuffer(new_cap);
+    Relocate(this->begin(), this->end(), new_data);
+    DeallocateBuffer(this->data_, this->capacity_);
     this->data_ = new_data;
     this->capacity_ = new_cap;
   }